@@ -0,0 +1,99 @@
+/* Usage: node benchmark.js path/to/rdsparser.node path/to/librdsparser.so [groups] */
+const path = require('path');
+const { Parser } = require(path.resolve(process.argv[2]));
+const library = process.argv[3] ? path.resolve(process.argv[3]) : null;
+const count = parseInt(process.argv[4] || '200000');
+const BATCH_SIZE = 12;
+
+const hex = function(value) {
+    return value.toString(16).toUpperCase().padStart(4, '0');
+};
+
+/* PS and RadioText changing every few hundred groups */
+const generate = function(count) {
+    let groups = [];
+    for (let i = 0; i < count; i++) {
+        let text = 0x4141 + ((i >> 8) % 26) * 0x0101;
+        if (i % 2) {
+            groups.push('A201' + hex(0x0400 | (i >> 1) % 4) + 'E0CD' + hex(text) + '00');
+        } else {
+            groups.push('A201' + hex(0x2000 | (i >> 1) % 16) + hex(text) + hex(text) + '00');
+        }
+    }
+    return groups;
+};
+
+const measure = function(name, run, groups) {
+    let start = process.hrtime.bigint();
+    for (let i = 0; i < groups.length; i += BATCH_SIZE) {
+        run(groups.slice(i, i + BATCH_SIZE));
+    }
+    let elapsed = Number(process.hrtime.bigint() - start) / 1e9;
+    console.log(name.padEnd(8) + (groups.length / elapsed).toFixed(0).padStart(10) + ' groups/s');
+};
+
+const native = function() {
+    let rds = new Parser();
+    return (batch) => rds.parseBatch(batch);
+};
+
+const ffi = function(koffi) {
+    const win32 = (process.platform == 'win32');
+    const unicode_type = (win32 ? 'int16_t' : 'int32_t');
+    const lib = koffi.load(library);
+    const rdsparser = {
+        new: lib.func('void* rdsparser_new()'),
+        parse_string: lib.func('bool rdsparser_parse_string(void *rds, const char *input)'),
+        get_pi: lib.func('int32_t rdsparser_get_pi(void *rds)'),
+        get_pty: lib.func('int8_t rdsparser_get_pty(void *rds)'),
+        get_ps: lib.func('void* rdsparser_get_ps(void *rds)'),
+        get_rt: lib.func('void* rdsparser_get_rt(void *rds, int flag)'),
+        register_pi: lib.func('void rdsparser_register_pi(void *rds, void *cb)'),
+        register_pty: lib.func('void rdsparser_register_pty(void *rds, void *cb)'),
+        register_ps: lib.func('void rdsparser_register_ps(void *rds, void *cb)'),
+        register_rt: lib.func('void rdsparser_register_rt(void *rds, void *cb)'),
+        string_get_content: lib.func(unicode_type + '* rdsparser_string_get_content(void *string)'),
+        string_get_errors: lib.func('uint8_t* rdsparser_string_get_errors(void *string)'),
+        string_get_length: lib.func('uint8_t rdsparser_string_get_length(void *string)')
+    };
+
+    /* Same decoding as examples/nodejs/example.js */
+    const decode = function(string) {
+        let length = rdsparser.string_get_length(string);
+        let content = koffi.decode(rdsparser.string_get_content(string), unicode_type + ' [' + length + ']');
+        let errors = koffi.decode(rdsparser.string_get_errors(string), 'uint8_t [' + length + ']');
+        return { text: String.fromCodePoint.apply(String, content), errors: Array.from(errors) };
+    };
+
+    let state = {};
+    let events = [];
+    koffi.proto('void bench_callback(void *rds, void *user_data)');
+    koffi.proto('void bench_callback_rt(void *rds, int flag, void *user_data)');
+    let rds = rdsparser.new();
+    rdsparser.register_pi(rds, koffi.register(rds => (state.pi = rdsparser.get_pi(rds), events.push('pi')), 'bench_callback*'));
+    rdsparser.register_pty(rds, koffi.register(rds => (state.pty = rdsparser.get_pty(rds), events.push('pty')), 'bench_callback*'));
+    rdsparser.register_ps(rds, koffi.register(rds => (state.ps = decode(rdsparser.get_ps(rds)), events.push('ps')), 'bench_callback*'));
+    rdsparser.register_rt(rds, koffi.register((rds, flag) => (state.rt = decode(rdsparser.get_rt(rds, flag)), events.push('rt')), 'bench_callback_rt*'));
+
+    return (batch) => {
+        events = [];
+        for (let group of batch) {
+            rdsparser.parse_string(rds, group);
+        }
+        return { state: state, events: events };
+    };
+};
+
+const groups = generate(count);
+measure('N-API', native(), groups);
+
+let koffi = null;
+try {
+    koffi = require('koffi');
+} catch (e) {
+    console.log('koffi not installed, skipping the FFI benchmark');
+}
+
+if (koffi && library) {
+    measure('koffi', ffi(koffi), groups);
+}
@@ -0,0 +1,540 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#define NAPI_VERSION 6
+#include <node_api.h>
+#include <librdsparser.h>
+
+/* Poll often enough that a batch never overflows the event ring */
+#define RDSPARSER_NODE_POLL_GROUPS 16
+/* Longest string (eRT) with four UTF-8 bytes per character */
+#define RDSPARSER_NODE_UTF8_SIZE (RDSPARSER_ERT_LENGTH * 4 + 1)
+#define RDSPARSER_NODE_LINE_SIZE 64
+
+#define RDSPARSER_NODE_CALL(env, call) \
+    do { if ((call) != napi_ok) { rdsparser_node_throw(env); return NULL; } } while (0)
+
+typedef struct rdsparser_node
+{
+    rdsparser_t *rds;
+    bool ct;
+    int64_t ct_epoch;
+    int16_t ct_offset;
+} rdsparser_node_t;
+
+static const char *const rdsparser_node_event_name[RDSPARSER_EVENT_TYPE_COUNT] =
+{
+    "pi",
+    "pty",
+    "tp",
+    "ta",
+    "ms",
+    "ecc",
+    "country",
+    "pin",
+    "la",
+    "slc",
+    "af",
+    "af_expire",
+    "ps",
+    "rt",
+    "rt_complete",
+    "ptyn",
+    "lps",
+    "ert",
+    "ct",
+    "eon",
+    "eon_ta",
+    "rtplus",
+    "oda",
+    "tmc"
+};
+
+static void
+rdsparser_node_throw(napi_env env)
+{
+    const napi_extended_error_info *info;
+    bool pending;
+
+    napi_is_exception_pending(env, &pending);
+    if (pending)
+    {
+        return;
+    }
+
+    napi_get_last_error_info(env, &info);
+    napi_throw_error(env, NULL, (info && info->error_message) ? info->error_message : "N-API call failed");
+}
+
+static napi_status
+rdsparser_node_set_int(napi_env    env,
+                       napi_value  object,
+                       const char *name,
+                       int64_t     value)
+{
+    napi_value number;
+    napi_status status = napi_create_int64(env, value, &number);
+    return (status == napi_ok) ? napi_set_named_property(env, object, name, number) : status;
+}
+
+static napi_value
+rdsparser_node_string(napi_env                  env,
+                      const rdsparser_string_t *string)
+{
+    char text[RDSPARSER_NODE_UTF8_SIZE];
+    napi_value object;
+    napi_value value;
+
+    if (string == NULL)
+    {
+        /* LPS and eRT are allocated only when enabled */
+        RDSPARSER_NODE_CALL(env, napi_get_null(env, &object));
+        return object;
+    }
+
+    RDSPARSER_NODE_CALL(env, napi_create_object(env, &object));
+
+    const rdsparser_string_error_t *errors = rdsparser_string_get_errors(string);
+    const uint8_t length = rdsparser_string_get_length(string);
+    size_t size = rdsparser_string_get_utf8(string, text, sizeof(text));
+    RDSPARSER_NODE_CALL(env, napi_create_string_utf8(env, text, size, &value));
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "text", value));
+
+    RDSPARSER_NODE_CALL(env, napi_create_array_with_length(env, length, &value));
+    for (uint8_t i = 0; i < length; i++)
+    {
+        napi_value error;
+        RDSPARSER_NODE_CALL(env, napi_create_uint32(env, errors[i], &error));
+        RDSPARSER_NODE_CALL(env, napi_set_element(env, value, i, error));
+    }
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "errors", value));
+
+    return object;
+}
+
+static napi_value
+rdsparser_node_snapshot(napi_env          env,
+                        rdsparser_node_t *node)
+{
+    const rdsparser_t *rds = node->rds;
+    uint32_t af[RDSPARSER_AF_TABLE_SIZE];
+    napi_value object;
+    napi_value value;
+
+    RDSPARSER_NODE_CALL(env, napi_create_object(env, &object));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "pi", rdsparser_get_pi(rds)));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "pty", rdsparser_get_pty(rds)));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "tp", rdsparser_get_tp(rds)));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "ta", rdsparser_get_ta(rds)));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "ms", rdsparser_get_ms(rds)));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "ecc", rdsparser_get_ecc(rds)));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "country", rdsparser_get_country(rds)));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "pin", rdsparser_get_pin(rds)));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, object, "la", rdsparser_get_la(rds)));
+
+    const size_t count = rdsparser_af_to_array(rdsparser_get_af(rds), af, RDSPARSER_AF_TABLE_SIZE);
+    RDSPARSER_NODE_CALL(env, napi_create_array_with_length(env, count, &value));
+    for (size_t i = 0; i < count; i++)
+    {
+        napi_value frequency;
+        RDSPARSER_NODE_CALL(env, napi_create_uint32(env, af[i], &frequency));
+        RDSPARSER_NODE_CALL(env, napi_set_element(env, value, (uint32_t)i, frequency));
+    }
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "af", value));
+
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "ps", rdsparser_node_string(env, rdsparser_get_ps(rds))));
+
+    RDSPARSER_NODE_CALL(env, napi_create_array_with_length(env, RDSPARSER_RT_FLAG_COUNT, &value));
+    for (uint8_t flag = 0; flag < RDSPARSER_RT_FLAG_COUNT; flag++)
+    {
+        napi_value rt = rdsparser_node_string(env, rdsparser_get_rt(rds, flag));
+        napi_value complete;
+        if (rt == NULL)
+        {
+            return NULL;
+        }
+        RDSPARSER_NODE_CALL(env, napi_get_boolean(env, rdsparser_get_rt_complete(rds, flag), &complete));
+        RDSPARSER_NODE_CALL(env, napi_set_named_property(env, rt, "complete", complete));
+        RDSPARSER_NODE_CALL(env, napi_set_element(env, value, flag, rt));
+    }
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "rt", value));
+
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "ptyn", rdsparser_node_string(env, rdsparser_get_ptyn(rds))));
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "lps", rdsparser_node_string(env, rdsparser_get_lps(rds))));
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "ert", rdsparser_node_string(env, rdsparser_get_ert(rds))));
+
+    if (node->ct)
+    {
+        RDSPARSER_NODE_CALL(env, napi_create_object(env, &value));
+        RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, value, "epoch", node->ct_epoch));
+        RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, value, "offset", node->ct_offset));
+    }
+    else
+    {
+        RDSPARSER_NODE_CALL(env, napi_get_null(env, &value));
+    }
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, object, "ct", value));
+
+    return object;
+}
+
+static bool
+rdsparser_node_poll(napi_env          env,
+                    rdsparser_node_t *node,
+                    napi_value        array,
+                    uint32_t         *length)
+{
+    rdsparser_event_t events[RDSPARSER_EVENT_QUEUE_SIZE];
+    const size_t count = rdsparser_poll_events(node->rds, events, RDSPARSER_EVENT_QUEUE_SIZE);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const rdsparser_event_t *event = &events[i];
+        napi_value object;
+        napi_value type;
+
+        if (event->type == RDSPARSER_EVENT_CT)
+        {
+            /* The snapshot has no CT field, keep the last one */
+            node->ct = true;
+            node->ct_epoch = event->value;
+            node->ct_offset = (int16_t)((int8_t)event->index * 30);
+        }
+
+        if (napi_create_object(env, &object) != napi_ok ||
+            napi_create_string_utf8(env, rdsparser_node_event_name[event->type], NAPI_AUTO_LENGTH, &type) != napi_ok ||
+            napi_set_named_property(env, object, "type", type) != napi_ok ||
+            rdsparser_node_set_int(env, object, "index", event->index) != napi_ok ||
+            rdsparser_node_set_int(env, object, "start", event->start) != napi_ok ||
+            rdsparser_node_set_int(env, object, "length", event->length) != napi_ok ||
+            rdsparser_node_set_int(env, object, "value", event->value) != napi_ok ||
+            napi_set_element(env, array, (*length)++, object) != napi_ok)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static rdsparser_node_t*
+rdsparser_node_unwrap(napi_env             env,
+                      napi_callback_info   info,
+                      size_t              *argc,
+                      napi_value          *argv)
+{
+    napi_value self;
+    rdsparser_node_t *node;
+
+    if (napi_get_cb_info(env, info, argc, argv, &self, NULL) != napi_ok ||
+        napi_unwrap(env, self, (void**)&node) != napi_ok)
+    {
+        rdsparser_node_throw(env);
+        return NULL;
+    }
+
+    return node;
+}
+
+static void
+rdsparser_node_finalize(napi_env  env,
+                        void     *data,
+                        void     *hint)
+{
+    rdsparser_node_t *node = data;
+    rdsparser_free(node->rds);
+    free(node);
+}
+
+static napi_value
+rdsparser_node_new(napi_env           env,
+                   napi_callback_info info)
+{
+    napi_value self;
+    rdsparser_node_t *node;
+
+    RDSPARSER_NODE_CALL(env, napi_get_cb_info(env, info, NULL, NULL, &self, NULL));
+
+    node = calloc(1, sizeof(rdsparser_node_t));
+    if (node == NULL ||
+        (node->rds = rdsparser_new()) == NULL ||
+        !rdsparser_set_events(node->rds, true))
+    {
+        if (node)
+        {
+            rdsparser_free(node->rds);
+            free(node);
+        }
+        napi_throw_error(env, NULL, "Failed to allocate the parser");
+        return NULL;
+    }
+
+    if (napi_wrap(env, self, node, rdsparser_node_finalize, NULL, NULL) != napi_ok)
+    {
+        rdsparser_node_finalize(env, node, NULL);
+        rdsparser_node_throw(env);
+        return NULL;
+    }
+
+    return self;
+}
+
+static napi_value
+rdsparser_node_parse_batch(napi_env           env,
+                           napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1];
+    rdsparser_node_t *node = rdsparser_node_unwrap(env, info, &argc, argv);
+    napi_value result;
+    napi_value events;
+    uint32_t events_length = 0;
+    uint32_t groups = 0;
+    bool is_array;
+    bool is_typedarray;
+
+    if (node == NULL)
+    {
+        return NULL;
+    }
+
+    RDSPARSER_NODE_CALL(env, napi_create_array(env, &events));
+    RDSPARSER_NODE_CALL(env, napi_is_array(env, argv[0], &is_array));
+    RDSPARSER_NODE_CALL(env, napi_is_typedarray(env, argv[0], &is_typedarray));
+
+    if (argc > 0 && is_array)
+    {
+        uint32_t length;
+        RDSPARSER_NODE_CALL(env, napi_get_array_length(env, argv[0], &length));
+
+        for (uint32_t i = 0; i < length; i++)
+        {
+            char line[RDSPARSER_NODE_LINE_SIZE];
+            napi_value element;
+            RDSPARSER_NODE_CALL(env, napi_get_element(env, argv[0], i, &element));
+            RDSPARSER_NODE_CALL(env, napi_get_value_string_utf8(env, element, line, sizeof(line), NULL));
+
+            if (rdsparser_parse_string(node->rds, line) &&
+                ++groups % RDSPARSER_NODE_POLL_GROUPS == 0 &&
+                !rdsparser_node_poll(env, node, events, &events_length))
+            {
+                rdsparser_node_throw(env);
+                return NULL;
+            }
+        }
+    }
+    else if (argc > 0 && is_typedarray)
+    {
+        napi_typedarray_type type;
+        size_t length;
+        void *data;
+        RDSPARSER_NODE_CALL(env, napi_get_typedarray_info(env, argv[0], &type, &length, &data, NULL, NULL));
+
+        if (type != napi_uint8_array)
+        {
+            napi_throw_type_error(env, NULL, "Expected a Buffer of hex lines");
+            return NULL;
+        }
+
+        const char *buffer = data;
+        const char *end = buffer + length;
+        while (buffer < end)
+        {
+            /* Split the buffer into chunks of complete lines */
+            const char *chunk = buffer;
+            for (uint32_t lines = 0; lines < RDSPARSER_NODE_POLL_GROUPS && buffer < end; lines++)
+            {
+                const char *line_end = memchr(buffer, '\n', (size_t)(end - buffer));
+                buffer = line_end ? line_end + 1 : end;
+            }
+
+            groups += (uint32_t)rdsparser_parse_buffer(node->rds, chunk, (size_t)(buffer - chunk));
+            if (!rdsparser_node_poll(env, node, events, &events_length))
+            {
+                rdsparser_node_throw(env);
+                return NULL;
+            }
+        }
+    }
+    else
+    {
+        napi_throw_type_error(env, NULL, "Expected an array of hex lines or a Buffer");
+        return NULL;
+    }
+
+    if (!rdsparser_node_poll(env, node, events, &events_length))
+    {
+        rdsparser_node_throw(env);
+        return NULL;
+    }
+
+    napi_value state = rdsparser_node_snapshot(env, node);
+    if (state == NULL)
+    {
+        return NULL;
+    }
+
+    RDSPARSER_NODE_CALL(env, napi_create_object(env, &result));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, result, "groups", groups));
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, result, "state", state));
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, result, "events", events));
+    RDSPARSER_NODE_CALL(env, rdsparser_node_set_int(env, result, "overflow", rdsparser_get_event_overflow(node->rds)));
+    return result;
+}
+
+static napi_value
+rdsparser_node_state(napi_env           env,
+                     napi_callback_info info)
+{
+    size_t argc = 0;
+    rdsparser_node_t *node = rdsparser_node_unwrap(env, info, &argc, NULL);
+    return node ? rdsparser_node_snapshot(env, node) : NULL;
+}
+
+static napi_value
+rdsparser_node_clear(napi_env           env,
+                     napi_callback_info info)
+{
+    size_t argc = 0;
+    rdsparser_node_t *node = rdsparser_node_unwrap(env, info, &argc, NULL);
+    rdsparser_event_t event;
+
+    if (node)
+    {
+        rdsparser_clear(node->rds);
+        /* Drop the events of the previous station */
+        while (rdsparser_pop_event(node->rds, &event));
+        node->ct = false;
+    }
+
+    return NULL;
+}
+
+static napi_value
+rdsparser_node_set_text_correction(napi_env           env,
+                                   napi_callback_info info)
+{
+    size_t argc = 3;
+    napi_value argv[3];
+    rdsparser_node_t *node = rdsparser_node_unwrap(env, info, &argc, argv);
+    uint32_t text, type, error;
+
+    if (node == NULL)
+    {
+        return NULL;
+    }
+
+    if (argc < 3 ||
+        napi_get_value_uint32(env, argv[0], &text) != napi_ok ||
+        napi_get_value_uint32(env, argv[1], &type) != napi_ok ||
+        napi_get_value_uint32(env, argv[2], &error) != napi_ok ||
+        text >= RDSPARSER_TEXT_COUNT ||
+        type >= RDSPARSER_BLOCK_TYPE_COUNT)
+    {
+        napi_throw_range_error(env, NULL, "Invalid text correction");
+        return NULL;
+    }
+
+    rdsparser_set_text_correction(node->rds, (rdsparser_text_t)text, (rdsparser_block_type_t)type, (rdsparser_block_error_t)error);
+    return NULL;
+}
+
+static napi_value
+rdsparser_node_set_text_progressive(napi_env           env,
+                                    napi_callback_info info)
+{
+    size_t argc = 2;
+    napi_value argv[2];
+    rdsparser_node_t *node = rdsparser_node_unwrap(env, info, &argc, argv);
+    uint32_t text;
+    bool state;
+
+    if (node == NULL)
+    {
+        return NULL;
+    }
+
+    if (argc < 2 ||
+        napi_get_value_uint32(env, argv[0], &text) != napi_ok ||
+        napi_get_value_bool(env, argv[1], &state) != napi_ok ||
+        text >= RDSPARSER_TEXT_COUNT)
+    {
+        napi_throw_range_error(env, NULL, "Invalid text progressive mode");
+        return NULL;
+    }
+
+    rdsparser_set_text_progressive(node->rds, (rdsparser_text_t)text, state);
+    return NULL;
+}
+
+static napi_value
+rdsparser_node_set_text_enabled(napi_env           env,
+                                napi_callback_info info)
+{
+    size_t argc = 2;
+    napi_value argv[2];
+    rdsparser_node_t *node = rdsparser_node_unwrap(env, info, &argc, argv);
+    uint32_t text;
+    bool state;
+
+    if (node == NULL)
+    {
+        return NULL;
+    }
+
+    if (argc < 2 ||
+        napi_get_value_uint32(env, argv[0], &text) != napi_ok ||
+        napi_get_value_bool(env, argv[1], &state) != napi_ok ||
+        text >= RDSPARSER_TEXT_COUNT)
+    {
+        napi_throw_range_error(env, NULL, "Invalid text");
+        return NULL;
+    }
+
+    if (!rdsparser_set_text_enabled(node->rds, (rdsparser_text_t)text, state))
+    {
+        napi_throw_error(env, NULL, "Failed to allocate the text");
+    }
+
+    return NULL;
+}
+
+static napi_value
+rdsparser_node_init(napi_env   env,
+                    napi_value exports)
+{
+    const napi_property_descriptor methods[] =
+    {
+        { "parseBatch", NULL, rdsparser_node_parse_batch, NULL, NULL, NULL, napi_default, NULL },
+        { "state", NULL, rdsparser_node_state, NULL, NULL, NULL, napi_default, NULL },
+        { "clear", NULL, rdsparser_node_clear, NULL, NULL, NULL, napi_default, NULL },
+        { "setTextCorrection", NULL, rdsparser_node_set_text_correction, NULL, NULL, NULL, napi_default, NULL },
+        { "setTextProgressive", NULL, rdsparser_node_set_text_progressive, NULL, NULL, NULL, napi_default, NULL },
+        { "setTextEnabled", NULL, rdsparser_node_set_text_enabled, NULL, NULL, NULL, napi_default, NULL }
+    };
+    napi_value parser;
+
+    RDSPARSER_NODE_CALL(env, napi_define_class(env, "Parser", NAPI_AUTO_LENGTH, rdsparser_node_new, NULL,
+                                               sizeof(methods) / sizeof(methods[0]), methods, &parser));
+    RDSPARSER_NODE_CALL(env, napi_set_named_property(env, exports, "Parser", parser));
+    return exports;
+}
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, rdsparser_node_init)
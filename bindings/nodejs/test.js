@@ -0,0 +1,51 @@
+const assert = require('assert');
+const path = require('path');
+const { Parser } = require(path.resolve(process.argv[2] || 'rdsparser.node'));
+
+const groups = [
+    '12340408E0CD4142',
+    '12340409E0CD4344',
+    '1234040AE0CD4546',
+    '1234040BE0CD4748'
+];
+
+/* Array of hex lines */
+let rds = new Parser();
+let result = rds.parseBatch(groups);
+assert.strictEqual(result.groups, 4);
+assert.strictEqual(result.overflow, 0);
+assert.strictEqual(result.state.pi, 0x1234);
+assert.strictEqual(result.state.ps.text, 'ABCDEFGH');
+assert.deepStrictEqual(result.state.ps.errors, [0, 0, 0, 0, 0, 0, 0, 0]);
+assert.strictEqual(result.state.rt.length, 2);
+assert.strictEqual(result.state.ct, null);
+assert.strictEqual(result.state.lps, null);
+assert.deepStrictEqual(result.events.slice(0, 2).map(e => e.type), ['pi', 'pty']);
+assert.strictEqual(result.events[0].value, 0x1234);
+assert.strictEqual(result.events.filter(e => e.type === 'ps').length, 4);
+
+/* Events are delivered only once */
+result = rds.parseBatch([]);
+assert.strictEqual(result.events.length, 0);
+assert.strictEqual(result.state.ps.text, 'ABCDEFGH');
+
+/* Buffer of lines, with a CT group and an invalid line */
+rds.clear();
+result = rds.parseBatch(Buffer.from(groups.join('\r\n') + '\nXYZ\n12344401D750018200\n'));
+assert.strictEqual(result.groups, 5);
+assert.strictEqual(result.state.ps.text, 'ABCDEFGH');
+assert.notStrictEqual(result.state.ct, null);
+assert.strictEqual(result.events.filter(e => e.type === 'ct').length, 1);
+
+/* Longer batches are polled in chunks and never overflow */
+result = rds.parseBatch(Array(1000).fill(groups).flat());
+assert.strictEqual(result.groups, 4000);
+assert.strictEqual(result.overflow, 0);
+
+assert.throws(() => rds.parseBatch(42), TypeError);
+assert.throws(() => rds.setTextCorrection(9, 0, 0), RangeError);
+rds.setTextCorrection(0, 0, 2);
+rds.setTextProgressive(0, true);
+rds.setTextEnabled(3, true);
+assert.strictEqual(rds.state().pi, 0x1234);
+assert.strictEqual(rds.state().lps.text.length, 32);
@@ -0,0 +1,58 @@
+"""Radio Data System parser (librdsparser)"""
+
+import json
+import struct
+
+from ._rdsparser import Parser as _Parser, EVENT_SIZE
+
+# Index of each name is the rdsparser_event_type_t value
+EVENT_TYPES = (
+    'pi', 'pty', 'tp', 'ta', 'ms', 'ecc', 'country', 'pin', 'la', 'slc',
+    'af', 'af_expire', 'ps', 'rt', 'rt_complete', 'ptyn', 'lps', 'ert',
+    'ct', 'eon', 'eon_ta', 'rtplus', 'oda', 'tmc'
+)
+
+# group: index of the group in the input, the rest as in rdsparser_event_t
+EVENT_FIELDS = (
+    ('group', '=u4'),
+    ('type', 'u1'),
+    ('index', 'u1'),
+    ('start', 'u1'),
+    ('length', 'u1'),
+    ('value', '=i8')
+)
+
+_EVENT_STRUCT = struct.Struct('=IBBBBq')
+assert _EVENT_STRUCT.size == EVENT_SIZE
+
+try:
+    import numpy
+    EVENT_DTYPE = numpy.dtype(list(EVENT_FIELDS))
+except ImportError:
+    numpy = None
+    EVENT_DTYPE = None
+
+
+def _events(data):
+    if numpy is not None:
+        return numpy.frombuffer(data, dtype=EVENT_DTYPE)
+    return list(_EVENT_STRUCT.iter_unpack(data))
+
+
+class Parser(_Parser):
+    """Parser context, the events are returned as a NumPy structured array
+    (EVENT_DTYPE) or a list of tuples when NumPy is not available."""
+
+    def parse(self, data, errors=None):
+        groups, events = super().parse(data, errors)
+        return groups, _events(events)
+
+    def parse_lines(self, buffer):
+        groups, events = super().parse_lines(buffer)
+        return groups, _events(events)
+
+    def state(self, errors=False):
+        return json.loads(self.json(errors=errors))
+
+    def state_delta(self, errors=False):
+        return json.loads(self.json_delta(errors=errors))
@@ -0,0 +1,456 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <librdsparser.h>
+
+#define RDSPARSER_PYTHON_EVENTS_INITIAL 1024
+#define RDSPARSER_PYTHON_JSON_SIZE 4096
+
+/* Layout of the records, matching rdsparser.EVENT_DTYPE */
+typedef struct rdsparser_python_event
+{
+    uint32_t group;
+    uint8_t type;
+    uint8_t index;
+    uint8_t start;
+    uint8_t length;
+    int64_t value;
+} rdsparser_python_event_t;
+
+typedef struct rdsparser_python_events
+{
+    rdsparser_python_event_t *event;
+    size_t count;
+    size_t size;
+    bool failed;
+} rdsparser_python_events_t;
+
+typedef struct rdsparser_python
+{
+    PyObject_HEAD
+    rdsparser_t *rds;
+    /* The parser runs without the GIL, refuse concurrent calls */
+    bool busy;
+} rdsparser_python_t;
+
+static void
+rdsparser_python_poll(rdsparser_python_t        *self,
+                      rdsparser_python_events_t *events,
+                      uint32_t                   group)
+{
+    rdsparser_event_t batch[RDSPARSER_EVENT_QUEUE_SIZE];
+    const size_t count = rdsparser_poll_events(self->rds, batch, RDSPARSER_EVENT_QUEUE_SIZE);
+
+    if (events->count + count > events->size)
+    {
+        size_t size = events->size ? events->size : RDSPARSER_PYTHON_EVENTS_INITIAL;
+        while (size < events->count + count)
+        {
+            size *= 2;
+        }
+
+        /* Called without the GIL, only the raw allocator is allowed */
+        rdsparser_python_event_t *event = PyMem_RawRealloc(events->event, size * sizeof(rdsparser_python_event_t));
+        if (event == NULL)
+        {
+            events->failed = true;
+            return;
+        }
+
+        events->event = event;
+        events->size = size;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        rdsparser_python_event_t *event = &events->event[events->count++];
+        event->group = group;
+        event->type = batch[i].type;
+        event->index = batch[i].index;
+        event->start = batch[i].start;
+        event->length = batch[i].length;
+        event->value = batch[i].value;
+    }
+}
+
+static PyObject*
+rdsparser_python_result(Py_ssize_t                 groups,
+                        rdsparser_python_events_t *events)
+{
+    PyObject *data;
+
+    if (events->failed)
+    {
+        PyMem_RawFree(events->event);
+        return PyErr_NoMemory();
+    }
+
+    data = PyBytes_FromStringAndSize((const char*)events->event,
+                                     (Py_ssize_t)(events->count * sizeof(rdsparser_python_event_t)));
+    PyMem_RawFree(events->event);
+
+    if (data == NULL)
+    {
+        return NULL;
+    }
+
+    return Py_BuildValue("(nN)", groups, data);
+}
+
+static bool
+rdsparser_python_begin(rdsparser_python_t *self)
+{
+    if (self->busy)
+    {
+        PyErr_SetString(PyExc_RuntimeError, "Parser is already in use by another thread");
+        return false;
+    }
+
+    self->busy = true;
+    return true;
+}
+
+static bool
+rdsparser_python_check_buffer(const Py_buffer *view,
+                              Py_ssize_t       itemsize,
+                              char             format,
+                              const char      *name)
+{
+    const char *type = view->format ? view->format : "B";
+
+    /* Native or little-endian only, as NumPy exports them */
+    if (type[0] == '@' || type[0] == '=' || type[0] == '<')
+    {
+        type++;
+    }
+
+    if (view->itemsize != itemsize ||
+        type[0] != format ||
+        type[1] != '\0' ||
+        (view->format && view->format[0] == '<' && !PY_LITTLE_ENDIAN))
+    {
+        PyErr_Format(PyExc_TypeError, "%s must be a %s array", name, (format == 'H') ? "uint16" : "uint8");
+        return false;
+    }
+
+    if ((view->len / itemsize) % RDSPARSER_BLOCK_COUNT)
+    {
+        PyErr_Format(PyExc_ValueError, "%s must have %d values per group", name, RDSPARSER_BLOCK_COUNT);
+        return false;
+    }
+
+    return true;
+}
+
+static PyObject*
+rdsparser_python_parse(rdsparser_python_t *self,
+                       PyObject           *args,
+                       PyObject           *kwargs)
+{
+    static char *keywords[] = { "data", "errors", NULL };
+    rdsparser_python_events_t events = { NULL, 0, 0, false };
+    PyObject *data_object;
+    PyObject *errors_object = Py_None;
+    Py_buffer data;
+    Py_buffer errors = { 0 };
+    Py_ssize_t count;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &data_object, &errors_object))
+    {
+        return NULL;
+    }
+
+    if (PyObject_GetBuffer(data_object, &data, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+    {
+        return NULL;
+    }
+
+    if (!rdsparser_python_check_buffer(&data, sizeof(uint16_t), 'H', "data"))
+    {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+
+    count = data.len / (Py_ssize_t)(sizeof(uint16_t) * RDSPARSER_BLOCK_COUNT);
+
+    if (errors_object != Py_None)
+    {
+        if (PyObject_GetBuffer(errors_object, &errors, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+        {
+            PyBuffer_Release(&data);
+            return NULL;
+        }
+
+        if (!rdsparser_python_check_buffer(&errors, sizeof(uint8_t), 'B', "errors") ||
+            errors.len != count * RDSPARSER_BLOCK_COUNT)
+        {
+            if (!PyErr_Occurred())
+            {
+                PyErr_SetString(PyExc_ValueError, "errors must have the same shape as data");
+            }
+            PyBuffer_Release(&errors);
+            PyBuffer_Release(&data);
+            return NULL;
+        }
+    }
+
+    if (!rdsparser_python_begin(self))
+    {
+        PyBuffer_Release(&errors);
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    const uint16_t *blocks = data.buf;
+    const uint8_t *levels = errors.buf;
+
+    for (Py_ssize_t i = 0; i < count && !events.failed; i++)
+    {
+        rdsparser_data_t group;
+        rdsparser_error_t group_errors;
+
+        for (uint8_t block = 0; block < RDSPARSER_BLOCK_COUNT; block++)
+        {
+            group[block] = blocks[i * RDSPARSER_BLOCK_COUNT + block];
+            group_errors[block] = levels ? levels[i * RDSPARSER_BLOCK_COUNT + block] : RDSPARSER_BLOCK_ERROR_NONE;
+        }
+
+        rdsparser_parse(self->rds, group, group_errors);
+        rdsparser_python_poll(self, &events, (uint32_t)i);
+    }
+    Py_END_ALLOW_THREADS
+
+    self->busy = false;
+    PyBuffer_Release(&errors);
+    PyBuffer_Release(&data);
+    return rdsparser_python_result(count, &events);
+}
+
+static PyObject*
+rdsparser_python_parse_lines(rdsparser_python_t *self,
+                             PyObject           *args)
+{
+    rdsparser_python_events_t events = { NULL, 0, 0, false };
+    Py_ssize_t groups = 0;
+    Py_buffer input;
+
+    if (!PyArg_ParseTuple(args, "y*", &input))
+    {
+        return NULL;
+    }
+
+    if (!rdsparser_python_begin(self))
+    {
+        PyBuffer_Release(&input);
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    const char *buffer = input.buf;
+    const char *end = buffer + input.len;
+
+    while (buffer < end && !events.failed)
+    {
+        const char *line_end = memchr(buffer, '\n', (size_t)(end - buffer));
+        const char *next = line_end ? line_end + 1 : end;
+
+        if (rdsparser_parse_buffer(self->rds, buffer, (size_t)(next - buffer)))
+        {
+            rdsparser_python_poll(self, &events, (uint32_t)groups++);
+        }
+
+        buffer = next;
+    }
+    Py_END_ALLOW_THREADS
+
+    self->busy = false;
+    PyBuffer_Release(&input);
+    return rdsparser_python_result(groups, &events);
+}
+
+static PyObject*
+rdsparser_python_write_json(rdsparser_python_t *self,
+                            PyObject           *args,
+                            PyObject           *kwargs,
+                            bool                delta)
+{
+    static char *keywords[] = { "errors", NULL };
+    char buffer[RDSPARSER_PYTHON_JSON_SIZE];
+    int errors = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", keywords, &errors))
+    {
+        return NULL;
+    }
+
+    if (!rdsparser_python_begin(self))
+    {
+        return NULL;
+    }
+
+    const unsigned flags = errors ? RDSPARSER_JSON_ERRORS : 0;
+    const size_t length = delta ? rdsparser_write_json_delta(self->rds, buffer, sizeof(buffer), flags)
+                                : rdsparser_write_json(self->rds, buffer, sizeof(buffer), flags);
+    self->busy = false;
+
+    if (length == 0)
+    {
+        PyErr_SetString(PyExc_RuntimeError, "JSON document does not fit the buffer");
+        return NULL;
+    }
+
+    return PyUnicode_FromStringAndSize(buffer, (Py_ssize_t)length);
+}
+
+static PyObject*
+rdsparser_python_json(rdsparser_python_t *self,
+                      PyObject           *args,
+                      PyObject           *kwargs)
+{
+    return rdsparser_python_write_json(self, args, kwargs, false);
+}
+
+static PyObject*
+rdsparser_python_json_delta(rdsparser_python_t *self,
+                            PyObject           *args,
+                            PyObject           *kwargs)
+{
+    return rdsparser_python_write_json(self, args, kwargs, true);
+}
+
+static PyObject*
+rdsparser_python_clear(rdsparser_python_t *self,
+                       PyObject           *unused)
+{
+    rdsparser_event_t event;
+
+    if (!rdsparser_python_begin(self))
+    {
+        return NULL;
+    }
+
+    rdsparser_clear(self->rds);
+    /* Drop the events of the previous station */
+    while (rdsparser_pop_event(self->rds, &event));
+    self->busy = false;
+
+    Py_RETURN_NONE;
+}
+
+static int
+rdsparser_python_init(rdsparser_python_t *self,
+                      PyObject           *args,
+                      PyObject           *kwargs)
+{
+    static char *keywords[] = { NULL };
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "", keywords))
+    {
+        return -1;
+    }
+
+    if (self->rds == NULL)
+    {
+        self->rds = rdsparser_new();
+        if (self->rds == NULL ||
+            !rdsparser_set_events(self->rds, true))
+        {
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static void
+rdsparser_python_dealloc(rdsparser_python_t *self)
+{
+    rdsparser_free(self->rds);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyMethodDef rdsparser_python_methods[] =
+{
+    { "parse", (PyCFunction)(void(*)(void))rdsparser_python_parse, METH_VARARGS | METH_KEYWORDS,
+      "parse(data, errors=None) -> (groups, events)\n\n"
+      "Parse uint16 [N, 4] blocks with optional uint8 [N, 4] error levels." },
+    { "parse_lines", (PyCFunction)rdsparser_python_parse_lines, METH_VARARGS,
+      "parse_lines(buffer) -> (groups, events)\n\n"
+      "Parse a bytes-like buffer of newline separated hex groups." },
+    { "json", (PyCFunction)(void(*)(void))rdsparser_python_json, METH_VARARGS | METH_KEYWORDS,
+      "json(errors=False) -> str\n\nCurrent state as a JSON document." },
+    { "json_delta", (PyCFunction)(void(*)(void))rdsparser_python_json_delta, METH_VARARGS | METH_KEYWORDS,
+      "json_delta(errors=False) -> str\n\nFields changed since the previous JSON document." },
+    { "clear", (PyCFunction)rdsparser_python_clear, METH_NOARGS,
+      "clear()\n\nReset the parser state." },
+    { NULL }
+};
+
+static PyTypeObject rdsparser_python_type =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "rdsparser._rdsparser.Parser",
+    .tp_doc = "RDS parser context",
+    .tp_basicsize = sizeof(rdsparser_python_t),
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_new = PyType_GenericNew,
+    .tp_init = (initproc)rdsparser_python_init,
+    .tp_dealloc = (destructor)rdsparser_python_dealloc,
+    .tp_methods = rdsparser_python_methods
+};
+
+static struct PyModuleDef rdsparser_python_module =
+{
+    PyModuleDef_HEAD_INIT,
+    .m_name = "_rdsparser",
+    .m_doc = "Radio Data System parser",
+    .m_size = -1
+};
+
+PyMODINIT_FUNC
+PyInit__rdsparser(void)
+{
+    PyObject *module;
+
+    if (PyType_Ready(&rdsparser_python_type) < 0)
+    {
+        return NULL;
+    }
+
+    module = PyModule_Create(&rdsparser_python_module);
+    if (module == NULL)
+    {
+        return NULL;
+    }
+
+    Py_INCREF(&rdsparser_python_type);
+    if (PyModule_AddObject(module, "Parser", (PyObject*)&rdsparser_python_type) < 0 ||
+        PyModule_AddIntConstant(module, "EVENT_SIZE", sizeof(rdsparser_python_event_t)) < 0)
+    {
+        Py_DECREF(&rdsparser_python_type);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    return module;
+}
@@ -0,0 +1,78 @@
+import array
+import threading
+import rdsparser
+
+GROUPS = (
+    (0x1234, 0x0408, 0xE0CD, 0x4142),
+    (0x1234, 0x0409, 0xE0CD, 0x4344),
+    (0x1234, 0x040A, 0xE0CD, 0x4546),
+    (0x1234, 0x040B, 0xE0CD, 0x4748)
+)
+
+
+def blocks(groups):
+    return array.array('H', [block for group in groups for block in group])
+
+
+def types(events):
+    return [rdsparser.EVENT_TYPES[event[1]] for event in events]
+
+
+# uint16 [N, 4] blocks without the error levels
+rds = rdsparser.Parser()
+groups, events = rds.parse(blocks(GROUPS))
+assert groups == 4
+assert types(events)[:2] == ['pi', 'pty']
+assert events[0][0] == 0 and events[0][5] == 0x1234
+assert types(events).count('ps') == 4
+assert events[-1][0] == 3
+state = rds.state(errors=True)
+assert state['pi'] == 0x1234
+assert state['ps'] == 'ABCDEFGH'
+assert state['ps_errors'] == [0] * 8
+assert rds.state_delta() == {}
+
+# Uncorrectable blocks are ignored
+rds.clear()
+errors = array.array('B', [0, 0, 0, 3] * 4)
+groups, events = rds.parse(blocks(GROUPS), errors)
+assert groups == 4
+assert 'ps' not in types(events)
+assert rds.state()['ps'] is None
+
+# Buffer of hex lines
+rds.clear()
+groups, events = rds.parse_lines(b'12340408E0CD4142\r\n12340409E0CD4344\nXYZ\n1234040AE0CD4546\n1234040BE0CD4748')
+assert groups == 4
+assert rds.state()['ps'] == 'ABCDEFGH'
+
+# Long captures never overflow the event ring
+groups, events = rds.parse(blocks(GROUPS * 5000))
+assert groups == 20000
+
+for data, error in ((array.array('I', [0] * 4), TypeError),
+                    (array.array('H', [0] * 5), ValueError)):
+    try:
+        rds.parse(data)
+        assert False
+    except error:
+        pass
+
+try:
+    rds.parse(blocks(GROUPS), array.array('B', [0] * 4))
+    assert False
+except ValueError:
+    pass
+
+# Other threads keep running while a capture is parsed
+threads = [threading.Thread(target=rdsparser.Parser().parse, args=(blocks(GROUPS * 1000),)) for i in range(4)]
+for thread in threads:
+    thread.start()
+for thread in threads:
+    thread.join()
+
+if rdsparser.numpy is not None:
+    data = rdsparser.numpy.array(GROUPS, dtype=rdsparser.numpy.uint16)
+    groups, events = rdsparser.Parser().parse(data)
+    assert events.dtype == rdsparser.EVENT_DTYPE
+    assert events['value'][0] == 0x1234
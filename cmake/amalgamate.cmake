@@ -0,0 +1,154 @@
+# Generates the single-file amalgamation of the library:
+#   rdsparser_amalgamated.h - public API (and the context layout for RDSPARSER_DISABLE_HEAP)
+#   rdsparser_amalgamated.c - all sources in one translation unit
+#
+# Usage: cmake [-DOUTPUT_DIR=<directory>] -P cmake/amalgamate.cmake
+#
+# Optional features are kept behind their RDSPARSER_DISABLE_* macros, so the
+# result can be configured with the same definitions as the CMake build.
+
+get_filename_component(ROOT_DIR ${CMAKE_CURRENT_LIST_DIR}/.. ABSOLUTE)
+if(NOT OUTPUT_DIR)
+    set(OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}/amalgamation)
+endif()
+
+include(${ROOT_DIR}/src/sources.cmake)
+
+set(NAME_REGEX "[A-Za-z_][A-Za-z0-9_]*")
+
+# Reads a file without its license block and includes of the library headers
+function(amalgamate_read OUTPUT PATH)
+    file(READ ${PATH} CONTENT)
+    if(CONTENT MATCHES "^/\\*  SPDX-License-Identifier")
+        string(FIND "${CONTENT}" "*/\n" END)
+        math(EXPR END "${END} + 3")
+        string(SUBSTRING "${CONTENT}" ${END} -1 CONTENT)
+    endif()
+    string(REGEX REPLACE "\n#include (\"${NAME_REGEX}\\.h\"|<librdsparser(_private)?\\.h>)[^\n]*" "" CONTENT "${CONTENT}")
+    set(${OUTPUT} "${CONTENT}" PARENT_SCOPE)
+endfunction()
+
+# Extracts the names matched by REGEX, the name being its last identifier
+function(amalgamate_names OUTPUT CONTENT REGEX SUFFIX)
+    string(REGEX MATCHALL "${REGEX}" MATCHES "${CONTENT}")
+    set(NAMES)
+    foreach(MATCH ${MATCHES})
+        string(REGEX REPLACE "^.*[\n *](${NAME_REGEX})${SUFFIX}$" "\\1" NAME "${MATCH}")
+        list(APPEND NAMES ${NAME})
+    endforeach()
+    set(${OUTPUT} ${NAMES} PARENT_SCOPE)
+endfunction()
+
+# Translation units in the build order, optional ones with their feature
+set(UNITS)
+foreach(FILE ${SOURCE_FILES})
+    if(FILE MATCHES "\\.c$")
+        list(APPEND UNITS ${FILE})
+    endif()
+endforeach()
+
+get_cmake_property(VARIABLES VARIABLES)
+foreach(VARIABLE ${VARIABLES})
+    if(VARIABLE MATCHES "^(.+)_SOURCE_FILES$")
+        set(FEATURE ${CMAKE_MATCH_1})
+        foreach(FILE ${${VARIABLE}})
+            if(FILE MATCHES "\\.c$")
+                list(APPEND UNITS ${FILE})
+                set(FEATURE_${FILE} ${FEATURE})
+            endif()
+        endforeach()
+    endif()
+endforeach()
+
+# Private headers in the order of their first use
+set(HEADERS)
+foreach(UNIT ${UNITS})
+    file(READ ${ROOT_DIR}/src/${UNIT} CONTENT)
+    string(REGEX MATCHALL "\n#include \"${NAME_REGEX}\\.h\"" INCLUDES "${CONTENT}")
+    foreach(INCLUDE ${INCLUDES})
+        string(REGEX REPLACE ".*\"(.+)\"" "\\1" HEADER "${INCLUDE}")
+        list(APPEND HEADERS ${HEADER})
+    endforeach()
+endforeach()
+list(REMOVE_DUPLICATES HEADERS)
+
+# Everything ends up in one scope: a file-local name
+# must not be defined again by another source file
+set(STATIC_NAMES)
+foreach(UNIT ${UNITS})
+    amalgamate_read(CONTENT ${ROOT_DIR}/src/${UNIT})
+    amalgamate_names(STATIC_FUNCTIONS "${CONTENT}" "\nstatic[^\n(;]*\n${NAME_REGEX}\\(" "\\(")
+    amalgamate_names(STATIC_VARIABLES "${CONTENT}" "\nstatic [^\n(;=]*[ *]${NAME_REGEX}(\\[[^\n=]*\\])? *=" "(\\[[^\n=]*\\])? *=")
+    amalgamate_names(FUNCTIONS "${CONTENT}" "\n${NAME_REGEX}\\(" "\\(")
+    set(NAMES ${STATIC_FUNCTIONS} ${STATIC_VARIABLES} ${FUNCTIONS})
+    if(NAMES)
+        list(REMOVE_DUPLICATES NAMES)
+    endif()
+    foreach(NAME ${NAMES})
+        list(APPEND OWNERS_${NAME} ${UNIT})
+    endforeach()
+    list(APPEND STATIC_NAMES ${STATIC_FUNCTIONS} ${STATIC_VARIABLES})
+endforeach()
+
+set(COLLISIONS)
+foreach(NAME ${STATIC_NAMES})
+    list(LENGTH OWNERS_${NAME} COUNT)
+    if(COUNT GREATER 1)
+        string(REPLACE ";" ", " FILES "${OWNERS_${NAME}}")
+        list(APPEND COLLISIONS "${NAME} (${FILES})")
+    endif()
+endforeach()
+if(COLLISIONS)
+    list(REMOVE_DUPLICATES COLLISIONS)
+    string(REPLACE ";" "\n  " COLLISIONS "${COLLISIONS}")
+    message(FATAL_ERROR "Static names defined in more than one source file:\n  ${COLLISIONS}")
+endif()
+
+file(READ ${ROOT_DIR}/src/log.c LICENSE)
+string(FIND "${LICENSE}" "*/\n" END)
+math(EXPR END "${END} + 3")
+string(SUBSTRING "${LICENSE}" 0 ${END} LICENSE)
+set(NOTICE "/* Generated by cmake/amalgamate.cmake, do not edit */\n")
+
+# Header: the public API with the context layout in place of its include
+amalgamate_read(PRIVATE ${ROOT_DIR}/include/librdsparser_private.h)
+file(READ ${ROOT_DIR}/include/librdsparser.h PUBLIC)
+string(FIND "${PUBLIC}" "*/\n" END)
+math(EXPR END "${END} + 3")
+string(SUBSTRING "${PUBLIC}" ${END} -1 PUBLIC)
+string(REPLACE "#include <librdsparser_private.h>\n" "${PRIVATE}" PUBLIC "${PUBLIC}")
+
+file(WRITE ${OUTPUT_DIR}/rdsparser_amalgamated.h "${LICENSE}\n${NOTICE}${PUBLIC}")
+
+# Source: the context layout, the private headers and the source files.
+# Feature test macro of file.c has to precede any system header.
+set(SOURCE "${LICENSE}\n${NOTICE}\n#ifndef _WIN32\n#define _DEFAULT_SOURCE\n#endif\n#include \"rdsparser_amalgamated.h\"\n${PRIVATE}")
+foreach(HEADER ${HEADERS})
+    amalgamate_read(CONTENT ${ROOT_DIR}/src/${HEADER})
+    string(APPEND SOURCE "\n/* src/${HEADER} */${CONTENT}")
+endforeach()
+
+foreach(UNIT ${UNITS})
+    amalgamate_read(CONTENT ${ROOT_DIR}/src/${UNIT})
+    string(REGEX REPLACE "\n#define _DEFAULT_SOURCE[^\n]*" "" CONTENT "${CONTENT}")
+    string(APPEND SOURCE "\n/* src/${UNIT} */\n")
+    if(FEATURE_${UNIT})
+        string(APPEND SOURCE "#ifndef RDSPARSER_DISABLE_${FEATURE_${UNIT}}")
+    endif()
+    string(APPEND SOURCE "${CONTENT}")
+
+    # Local macros do not leak into the next file
+    string(REGEX MATCHALL "\n#define ${NAME_REGEX}" DEFINES "${CONTENT}")
+    foreach(DEFINE ${DEFINES})
+        string(REGEX REPLACE "\n#define " "" NAME "${DEFINE}")
+        if(NOT NAME MATCHES "^_")
+            string(APPEND SOURCE "#undef ${NAME}\n")
+        endif()
+    endforeach()
+
+    if(FEATURE_${UNIT})
+        string(APPEND SOURCE "#endif\n")
+    endif()
+endforeach()
+
+file(WRITE ${OUTPUT_DIR}/rdsparser_amalgamated.c "${SOURCE}")
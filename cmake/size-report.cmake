@@ -0,0 +1,94 @@
+# Prints the footprint of the library for each feature configuration.
+# Invoked by the size-report target:
+#   cmake -DSOURCE_DIR=... -DBINARY_DIR=... -DNM=... -P size-report.cmake
+
+set(FEATURES LOOKUPS AF RT_B GROUP1 GROUP4 GROUP10 STATION_CACHE FILE)
+set(CONFIGS default ${FEATURES} all)
+
+if(NOT NM)
+    set(NM nm)
+endif()
+string(REGEX REPLACE "nm([^/]*)$" "size\\1" SIZE "${NM}")
+
+# Sums the sections starting with any of the given prefixes
+function(section_sum OUTPUT ARCHIVE)
+    execute_process(COMMAND ${SIZE} -A ${ARCHIVE}
+                    OUTPUT_VARIABLE LINES
+                    RESULT_VARIABLE RESULT)
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "Unable to run ${SIZE}")
+    endif()
+
+    set(SUM 0)
+    string(REPLACE "\n" ";" LINES "${LINES}")
+    foreach(LINE ${LINES})
+        foreach(PREFIX ${ARGN})
+            if(LINE MATCHES "^${PREFIX}[^ ]* +([0-9]+)")
+                math(EXPR SUM "${SUM} + ${CMAKE_MATCH_1}")
+            endif()
+        endforeach()
+    endforeach()
+    set(${OUTPUT} ${SUM} PARENT_SCOPE)
+endfunction()
+
+function(column OUTPUT VALUE WIDTH)
+    string(LENGTH "${VALUE}" LENGTH)
+    math(EXPR PAD "${WIDTH} - ${LENGTH}")
+    if(PAD GREATER 0)
+        string(REPEAT " " ${PAD} SPACES)
+    endif()
+    set(${OUTPUT} "${VALUE}${SPACES}" PARENT_SCOPE)
+endfunction()
+
+column(HEADER "Configuration" 16)
+message("${HEADER}.text    .rodata  .data    sizeof(rdsparser_t)")
+
+foreach(CONFIG ${CONFIGS})
+    set(OPTIONS
+        -DCMAKE_BUILD_TYPE=MinSizeRel
+        -DRDSPARSER_DISABLE_TESTS=ON
+        -DRDSPARSER_DISABLE_EXAMPLES=ON
+        -DRDSPARSER_DISABLE_TOOLS=ON
+        -DRDSPARSER_DISABLE_BINDINGS=ON)
+
+    foreach(FEATURE ${FEATURES})
+        if(CONFIG STREQUAL FEATURE OR CONFIG STREQUAL "all")
+            list(APPEND OPTIONS -DRDSPARSER_DISABLE_${FEATURE}=ON)
+        else()
+            list(APPEND OPTIONS -DRDSPARSER_DISABLE_${FEATURE}=OFF)
+        endif()
+    endforeach()
+
+    set(BUILD ${BINARY_DIR}/${CONFIG})
+    execute_process(COMMAND ${CMAKE_COMMAND} -S ${SOURCE_DIR} -B ${BUILD} ${OPTIONS}
+                    OUTPUT_QUIET
+                    RESULT_VARIABLE RESULT)
+    if(RESULT EQUAL 0)
+        execute_process(COMMAND ${CMAKE_COMMAND} --build ${BUILD} --target rdsparser_static rdsparser_size
+                        OUTPUT_QUIET
+                        RESULT_VARIABLE RESULT)
+    endif()
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "Unable to build the ${CONFIG} configuration")
+    endif()
+
+    file(GLOB ARCHIVE ${BUILD}/src/*rdsparser_static*)
+    file(GLOB PROBE ${BUILD}/src/*rdsparser_size*)
+    section_sum(TEXT ${ARCHIVE} "\\.text")
+    section_sum(RODATA ${ARCHIVE} "\\.rodata")
+    # Tables of string pointers need relocations in the PIC archive
+    section_sum(DATA ${ARCHIVE} "\\.data")
+
+    execute_process(COMMAND ${NM} -S -t d ${PROBE}
+                    OUTPUT_VARIABLE SYMBOLS)
+    set(CONTEXT "?")
+    if(SYMBOLS MATCHES "[0-9]+ 0*([0-9]+) [A-Za-z] rdsparser_size_context")
+        set(CONTEXT ${CMAKE_MATCH_1})
+    endif()
+
+    column(CONFIG ${CONFIG} 16)
+    column(TEXT ${TEXT} 9)
+    column(RODATA ${RODATA} 9)
+    column(DATA ${DATA} 9)
+    message("${CONFIG}${TEXT}${RODATA}${DATA}${CONTEXT}")
+endforeach()
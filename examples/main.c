@@ -218,7 +218,11 @@ callback_pty(rdsparser_t *rds,
              void        *user_data)
 {
     rdsparser_pty_t pty = rdsparser_get_pty(rds);
+#ifndef RDSPARSER_DISABLE_LOOKUPS
     printf("PTY: %s (%d)\n", rdsparser_pty_lookup_long(pty, false), pty);
+#else
+    printf("PTY: %d\n", pty);
+#endif
 }
 
 static void
@@ -254,9 +258,13 @@ callback_country(rdsparser_t *rds,
                  void        *user_data)
 {
     rdsparser_country_t country = rdsparser_get_country(rds);
+#ifndef RDSPARSER_DISABLE_LOOKUPS
     printf("Country: %s (%s)\n",
            rdsparser_country_lookup_name(country),
            rdsparser_country_lookup_iso(country));
+#else
+    printf("Country: %d\n", country);
+#endif
 }
 
 static void
@@ -317,6 +325,7 @@ callback_ptyn(rdsparser_t *rds,
 #endif
 }
 
+#ifndef RDSPARSER_DISABLE_GROUP4
 static void
 callback_ct(rdsparser_t          *rds,
             const rdsparser_ct_t *ct,
@@ -334,6 +343,7 @@ callback_ct(rdsparser_t          *rds,
            abs(offset / 60),
            abs(offset % 60));
 }
+#endif
 
 int
 main(int   argc,
@@ -377,7 +387,9 @@ main(int   argc,
     rdsparser_register_ps(rds, callback_ps);
     rdsparser_register_rt(rds, callback_rt);
     rdsparser_register_ptyn(rds, callback_ptyn);
+#ifndef RDSPARSER_DISABLE_GROUP4
     rdsparser_register_ct(rds, callback_ct);
+#endif
 
     for (size_t i = 0; i < sizeof(rds_data) / sizeof(char*); i++)
     {
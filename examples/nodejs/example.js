@@ -6,18 +6,31 @@ const unicode_type = (win32 ? 'int16_t' : 'int32_t')
 const filename = 'librdsparser.' + (win32 ? 'dll' : 'so')
 const lib = koffi.load(path.join(__dirname, filename));
 
-koffi.proto('void callback_pi(void *rds, void *user_data)');
-koffi.proto('void callback_pty(void *rds, void *user_data)');
-koffi.proto('void callback_tp(void *rds, void *user_data)');
-koffi.proto('void callback_ta(void *rds, void *user_data)');
-koffi.proto('void callback_ms(void *rds, void *user_data)');
-koffi.proto('void callback_ecc(void *rds, void *user_data)');
-koffi.proto('void callback_country(void *rds, void *user_data)');
-koffi.proto('void callback_af(void *rds, uint32_t af, void *user_data)');
-koffi.proto('void callback_ps(void *rds, void *user_data)');
-koffi.proto('void callback_rt(void *rds, int flag, void *user_data)');
-koffi.proto('void callback_ptyn(void *rds, void *user_data)');
-koffi.proto('void callback_ct(void *rds, void *ct, void *user_data)');
+const rdsparser_event_t = koffi.struct('rdsparser_event_t', {
+    type: 'uint8_t',
+    index: 'uint8_t',
+    start: 'uint8_t',
+    length: 'uint8_t',
+    value: 'int64_t',
+    text: koffi.array(unicode_type, 8)
+});
+
+const EVENT = {
+    PI: 0,
+    PTY: 1,
+    TP: 2,
+    TA: 3,
+    MS: 4,
+    ECC: 5,
+    COUNTRY: 6,
+    AF: 10,
+    PS: 12,
+    RT: 13,
+    PTYN: 15,
+    CT: 18
+};
+
+const EVENT_QUEUE_SIZE = 256;
 
 const rdsparser = {
     new: lib.func('void* rdsparser_new()'),
@@ -37,27 +50,12 @@ const rdsparser = {
     get_ps: lib.func('void* rdsparser_get_ps(void *rds)'),
     get_rt: lib.func('void* rdsparser_get_rt(void *rds, int flag)'),
     get_ptyn: lib.func('void* rdsparser_get_ptyn(void *rds)'),
-    register_pi: lib.func('void rdsparser_register_pi(void *rds, void *cb)'),
-    register_pty: lib.func('void rdsparser_register_pty(void *rds, void *cb)'),
-    register_tp: lib.func('void rdsparser_register_tp(void *rds, void *cb)'),
-    register_ta: lib.func('void rdsparser_register_ta(void *rds, void *cb)'),
-    register_ms: lib.func('void rdsparser_register_ms(void *rds, void *cb)'),
-    register_ecc: lib.func('void rdsparser_register_ecc(void *rds, void *cb)'),
-    register_country: lib.func('void rdsparser_register_country(void *rds, void *cb)'),
-    register_af: lib.func('void rdsparser_register_af(void *rds, void *cb)'),
-    register_ps: lib.func('void rdsparser_register_ps(void *rds, void *cb)'),
-    register_rt: lib.func('void rdsparser_register_rt(void *rds, void *cb)'),
-    register_ptyn: lib.func('void rdsparser_register_ptyn(void *rds, void *cb)'),
-    register_ct: lib.func('void rdsparser_register_ct(void *rds, void *cb)'),
+    set_events: lib.func('bool rdsparser_set_events(void *rds, bool state)'),
+    poll_events: lib.func('size_t rdsparser_poll_events(void *rds, _Out_ rdsparser_event_t *out, size_t cap)'),
+    get_event_overflow: lib.func('uint32_t rdsparser_get_event_overflow(void *rds)'),
     string_get_content: lib.func(unicode_type + '* rdsparser_string_get_content(void *string)'),
     string_get_errors: lib.func('uint8_t* rdsparser_string_get_errors(void *string)'),
     string_get_length: lib.func('uint8_t rdsparser_string_get_length(void *string)'),
-    ct_get_year: lib.func('uint16_t rdsparser_ct_get_year(void *ct)'),
-    ct_get_month: lib.func('uint8_t rdsparser_ct_get_month(void *ct)'),
-    ct_get_day: lib.func('uint8_t rdsparser_ct_get_day(void *ct)'),
-    ct_get_hour: lib.func('uint8_t rdsparser_ct_get_hour(void *ct)'),
-    ct_get_minute: lib.func('uint8_t rdsparser_ct_get_minute(void *ct)'),
-    ct_get_offset: lib.func('int8_t rdsparser_ct_get_offset(void *ct)'),
     pty_lookup_short: lib.func('const char* rdsparser_pty_lookup_short(int8_t pty, bool rbds)'),
     pty_lookup_long: lib.func('const char* rdsparser_pty_lookup_long(int8_t pty, bool rbds)'),
     country_lookup_name: lib.func('const char* rdsparser_country_lookup_name(int country)'),
@@ -84,82 +82,76 @@ const decode_errors = function(string) {
     return '';
 };
 
-const callbacks = {
-    pi: koffi.register(rds => (
-        value = rdsparser.get_pi(rds),
-        console.log('PI: ' + value.toString(16).toUpperCase())
-    ), 'callback_pi*'),
+const pad = function(value) {
+    return String(value).padStart(2, '0');
+};
+
+const handlers = {
+    [EVENT.PI]: (rds, event) => (
+        console.log('PI: ' + event.value.toString(16).toUpperCase())
+    ),
 
-    pty: koffi.register(rds => (
-        value = rdsparser.get_pty(rds),
-        display = rdsparser.pty_lookup_long(value, false),
-        console.log('PTY: ' + display + ' (' + value + ')')
-    ), 'callback_pty*'),
+    [EVENT.PTY]: (rds, event) => (
+        display = rdsparser.pty_lookup_long(Number(event.value), false),
+        console.log('PTY: ' + display + ' (' + event.value + ')')
+    ),
 
-    tp: koffi.register(rds => (
-        value = rdsparser.get_tp(rds),
-        console.log('TP: ' + value)
-    ), 'callback_tp*'),
+    [EVENT.TP]: (rds, event) => (
+        console.log('TP: ' + event.value)
+    ),
 
-    ta: koffi.register(rds => (
-        value = rdsparser.get_ta(rds),
-        console.log('TA: ' + value)
-    ), 'callback_ta*'),
+    [EVENT.TA]: (rds, event) => (
+        console.log('TA: ' + event.value)
+    ),
 
-    ms: koffi.register(rds => (
-        value = rdsparser.get_ms(rds),
-        console.log('MS: ' + value)
-    ), 'callback_ms*'),
+    [EVENT.MS]: (rds, event) => (
+        console.log('MS: ' + event.value)
+    ),
 
-    af: koffi.register((rds, value) => (
-        console.log('AF: ' + value)
-    ), 'callback_af*'),
+    [EVENT.AF]: (rds, event) => (
+        console.log('AF: ' + event.value)
+    ),
 
-    ecc: koffi.register(rds => (
-        value = rdsparser.get_ecc(rds),
-        console.log('ECC: ' + value.toString(16).toUpperCase())
-    ), 'callback_ecc*'),
+    [EVENT.ECC]: (rds, event) => (
+        console.log('ECC: ' + event.value.toString(16).toUpperCase())
+    ),
 
-    country: koffi.register(rds => (
-        value = rdsparser.get_country(rds),
-        display = rdsparser.country_lookup_name(value),
-        iso = rdsparser.country_lookup_iso(value),
+    [EVENT.COUNTRY]: (rds, event) => (
+        display = rdsparser.country_lookup_name(Number(event.value)),
+        iso = rdsparser.country_lookup_iso(Number(event.value)),
         console.log('Country: ' + display + ' (' + iso + ')')
-    ), 'callback_country*'),
+    ),
 
-    ps: koffi.register(rds => (
+    [EVENT.PS]: (rds, event) => (
         ps = rdsparser.get_ps(rds),
         value = decode_unicode(ps),
         errors = decode_errors(ps),
         console.log('PS: ' + value +  '(' + errors + ')')
-    ), 'callback_ps*'),
+    ),
 
-    rt: koffi.register((rds, flag) => (
-        rt = rdsparser.get_rt(rds, flag),
+    [EVENT.RT]: (rds, event) => (
+        rt = rdsparser.get_rt(rds, event.index),
         value = decode_unicode(rt),
         errors = decode_errors(rt),
-        console.log('RT' + flag  + ': ' + value + ' (' + errors + ')')
-    ), 'callback_rt*'),
+        console.log('RT' + event.index  + ': ' + value + ' (' + errors + ')')
+    ),
 
-    ptyn: koffi.register((rds, flag) => (
+    [EVENT.PTYN]: (rds, event) => (
         ptyn = rdsparser.get_ptyn(rds),
         value = decode_unicode(ptyn),
         errors = decode_errors(ptyn),
         console.log('PTYN: ' + value + ' (' + errors + ')')
-    ), 'callback_ptyn*'),
+    ),
 
-    ct: koffi.register((rds, ct) => (
-        year = rdsparser.ct_get_year(ct),
-        month = String(rdsparser.ct_get_month(ct)).padStart(2, '0'),
-        day = String(rdsparser.ct_get_day(ct)).padStart(2, '0'),
-        hour = String(rdsparser.ct_get_hour(ct)).padStart(2, '0'),
-        minute = String(rdsparser.ct_get_minute(ct)).padStart(2, '0'),
-        offset = rdsparser.ct_get_offset(ct),
+    [EVENT.CT]: (rds, event) => (
+        /* value is the UTC epoch, index the local offset in half-hours */
+        offset = ((event.index << 24) >> 24) * 30,
+        local = new Date((Number(event.value) + offset * 60) * 1000),
         tz_sign = (offset >= 0 ? '+' : '-'),
-        tz_hour = String(Math.abs(Math.floor(offset / 60))).padStart(2, '0'),
-        tz_minute = String(Math.abs(offset % 60)).padStart(2, '0'),
-        console.log('CT: ' + year + '-' + month + '-' + day + ' ' + hour + ':' + minute + ' (' + tz_sign + tz_hour + ':' + tz_minute + ')')
-    ), 'callback_ct*')
+        tz_hour = pad(Math.floor(Math.abs(offset) / 60)),
+        tz_minute = pad(Math.abs(offset) % 60),
+        console.log('CT: ' + local.getUTCFullYear() + '-' + pad(local.getUTCMonth() + 1) + '-' + pad(local.getUTCDate()) + ' ' + pad(local.getUTCHours()) + ':' + pad(local.getUTCMinutes()) + ' (' + tz_sign + tz_hour + ':' + tz_minute + ')')
+    )
 }
 
 let rds = rdsparser.new()
@@ -169,18 +161,7 @@ rdsparser.set_text_correction(rds, 1, 0, 2);
 rdsparser.set_text_correction(rds, 1, 1, 2);
 rdsparser.set_text_progressive(rds, 0, true);
 rdsparser.set_text_progressive(rds, 1, true);
-rdsparser.register_pi(rds, callbacks.pi);
-rdsparser.register_pty(rds, callbacks.pty);
-rdsparser.register_tp(rds, callbacks.tp);
-rdsparser.register_ta(rds, callbacks.ta);
-rdsparser.register_ms(rds, callbacks.ms);
-rdsparser.register_ecc(rds, callbacks.ecc);
-rdsparser.register_country(rds, callbacks.country);
-rdsparser.register_af(rds, callbacks.af);
-rdsparser.register_ps(rds, callbacks.ps);
-rdsparser.register_rt(rds, callbacks.rt);
-rdsparser.register_ptyn(rds, callbacks.ptyn);
-rdsparser.register_ct(rds, callbacks.ct);
+rdsparser.set_events(rds, true);
 
 let data = [
     "A20120017420696E02",
@@ -368,12 +349,30 @@ let data = [
     "A201100000E0000000", // ECC
 ]
 
-for (let group of data) {
-    rdsparser.parse_string(rds, group);
+const poll = function(rds, events) {
+    /* All the changes since the last poll are fetched with a single call */
+    let count = rdsparser.poll_events(rds, events, events.length);
+    for (let i = 0; i < count; i++) {
+        let handler = handlers[events[i].type];
+        if (handler) {
+            handler(rds, events[i]);
+        }
+    }
+};
+
+/* About a second of groups per batch, strings are read at the end of it */
+const BATCH_SIZE = 12;
+let events = new Array(EVENT_QUEUE_SIZE);
+
+for (let i = 0; i < data.length; i += BATCH_SIZE) {
+    for (let group of data.slice(i, i + BATCH_SIZE)) {
+        rdsparser.parse_string(rds, group);
+    }
+    poll(rds, events);
 }
 
-for (let cb in callbacks) {
-    koffi.unregister(callbacks[cb]);
+if (rdsparser.get_event_overflow(rds)) {
+    console.log('Lost events: ' + rdsparser.get_event_overflow(rds));
 }
 
 rdsparser.free(rds);
@@ -16,17 +16,47 @@
 
 #ifndef RDSPARSER_H
 #define RDSPARSER_H
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
+
+#ifndef RDSPARSER_API
+#if defined(_WIN32) || defined(__CYGWIN__)
+#ifdef RDSPARSER_EXPORTS
+#define RDSPARSER_API __declspec(dllexport)
+#else
+#define RDSPARSER_API
+#endif
+#elif defined(__GNUC__) && __GNUC__ >= 4
+#define RDSPARSER_API __attribute__((visibility("default")))
+#else
+#define RDSPARSER_API
+#endif
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #define RDSPARSER_AF_BUFFER_SIZE 26
+#define RDSPARSER_AF_TABLE_SIZE 205
 #define RDSPARSER_PS_LENGTH 8
 #define RDSPARSER_RT_LENGTH 64
 #define RDSPARSER_PTYN_LENGTH 8
+#define RDSPARSER_LPS_LENGTH 32
+#define RDSPARSER_ERT_LENGTH 128
+#define RDSPARSER_EON_TABLE_SIZE 8
+#define RDSPARSER_EON_MAPPING_SIZE 4
+#define RDSPARSER_RTPLUS_TAG_COUNT 4
+#define RDSPARSER_ODA_HANDLER_COUNT 8
+#define RDSPARSER_TMC_QUEUE_SIZE 32
+#define RDSPARSER_TMC_WINDOW 2048
+#define RDSPARSER_LOG_HEADER_SIZE 8
+#define RDSPARSER_LOG_SYNC_INTERVAL 64
+#define RDSPARSER_STATION_CACHE_SIZE 16
+#define RDSPARSER_EVENT_QUEUE_SIZE 256
+#define RDSPARSER_EVENT_TEXT_LENGTH 8
 
 typedef uint8_t rdsparser_block_t;
 enum rdsparser_block
@@ -61,6 +91,8 @@ enum rdsparser_text
     RDSPARSER_TEXT_PS = 0,
     RDSPARSER_TEXT_RT = 1,
     RDSPARSER_TEXT_PTYN = 2,
+    RDSPARSER_TEXT_LPS = 3,
+    RDSPARSER_TEXT_ERT = 4,
     RDSPARSER_TEXT_COUNT
 };
 
@@ -80,6 +112,76 @@ enum rdsparser_string_error
     RDSPARSER_STRING_ERROR_UNCORRECTABLE
 };
 
+typedef uint8_t rdsparser_string_encoding_t;
+enum rdsparser_string_encoding
+{
+    RDSPARSER_STRING_ENCODING_BASIC = 0,
+    RDSPARSER_STRING_ENCODING_UTF8 = 1
+};
+
+/* Text fields follow the rdsparser_text order */
+typedef uint8_t rdsparser_field_t;
+enum rdsparser_field
+{
+    RDSPARSER_FIELD_PI = 0,
+    RDSPARSER_FIELD_PTY = 1,
+    RDSPARSER_FIELD_TP = 2,
+    RDSPARSER_FIELD_TA = 3,
+    RDSPARSER_FIELD_MS = 4,
+    RDSPARSER_FIELD_ECC = 5,
+    RDSPARSER_FIELD_PIN = 6,
+    RDSPARSER_FIELD_PS = 7,
+    RDSPARSER_FIELD_RT = 8,
+    RDSPARSER_FIELD_PTYN = 9,
+    RDSPARSER_FIELD_LPS = 10,
+    RDSPARSER_FIELD_ERT = 11,
+    RDSPARSER_FIELD_COUNT
+};
+
+typedef uint8_t rdsparser_event_type_t;
+enum rdsparser_event_type
+{
+    RDSPARSER_EVENT_PI = 0,
+    RDSPARSER_EVENT_PTY = 1,
+    RDSPARSER_EVENT_TP = 2,
+    RDSPARSER_EVENT_TA = 3,
+    RDSPARSER_EVENT_MS = 4,
+    RDSPARSER_EVENT_ECC = 5,
+    RDSPARSER_EVENT_COUNTRY = 6,
+    RDSPARSER_EVENT_PIN = 7,
+    RDSPARSER_EVENT_LA = 8,
+    RDSPARSER_EVENT_SLC = 9,
+    RDSPARSER_EVENT_AF = 10,
+    RDSPARSER_EVENT_AF_EXPIRE = 11,
+    RDSPARSER_EVENT_PS = 12,
+    RDSPARSER_EVENT_RT = 13,
+    RDSPARSER_EVENT_RT_COMPLETE = 14,
+    RDSPARSER_EVENT_PTYN = 15,
+    RDSPARSER_EVENT_LPS = 16,
+    RDSPARSER_EVENT_ERT = 17,
+    RDSPARSER_EVENT_CT = 18,
+    RDSPARSER_EVENT_EON = 19,
+    RDSPARSER_EVENT_EON_TA = 20,
+    RDSPARSER_EVENT_RTPLUS = 21,
+    RDSPARSER_EVENT_ODA = 22,
+    RDSPARSER_EVENT_TMC = 23,
+    RDSPARSER_EVENT_TYPE_COUNT
+};
+
+typedef uint8_t rdsparser_json_flag_t;
+enum rdsparser_json_flag
+{
+    RDSPARSER_JSON_ERRORS = 1 << 0
+};
+
+typedef uint8_t rdsparser_station_cache_t;
+enum rdsparser_station_cache
+{
+    RDSPARSER_STATION_CACHE_OFF = 0,
+    RDSPARSER_STATION_CACHE_PI = 1,
+    RDSPARSER_STATION_CACHE_PI_FREQUENCY = 2
+};
+
 typedef uint8_t rdsparser_rt_flag_t;
 enum rdsparser_rt_flag
 {
@@ -88,9 +190,96 @@ enum rdsparser_rt_flag
     RDSPARSER_RT_FLAG_COUNT
 };
 
+typedef uint8_t rdsparser_rtplus_type_t;
+enum rdsparser_rtplus_type
+{
+    RDSPARSER_RTPLUS_DUMMY_CLASS = 0,
+    RDSPARSER_RTPLUS_ITEM_TITLE = 1,
+    RDSPARSER_RTPLUS_ITEM_ALBUM = 2,
+    RDSPARSER_RTPLUS_ITEM_TRACKNUMBER = 3,
+    RDSPARSER_RTPLUS_ITEM_ARTIST = 4,
+    RDSPARSER_RTPLUS_ITEM_COMPOSITION = 5,
+    RDSPARSER_RTPLUS_ITEM_MOVEMENT = 6,
+    RDSPARSER_RTPLUS_ITEM_CONDUCTOR = 7,
+    RDSPARSER_RTPLUS_ITEM_COMPOSER = 8,
+    RDSPARSER_RTPLUS_ITEM_BAND = 9,
+    RDSPARSER_RTPLUS_ITEM_COMMENT = 10,
+    RDSPARSER_RTPLUS_ITEM_GENRE = 11,
+    RDSPARSER_RTPLUS_INFO_NEWS = 12,
+    RDSPARSER_RTPLUS_INFO_NEWS_LOCAL = 13,
+    RDSPARSER_RTPLUS_INFO_STOCKMARKET = 14,
+    RDSPARSER_RTPLUS_INFO_SPORT = 15,
+    RDSPARSER_RTPLUS_INFO_LOTTERY = 16,
+    RDSPARSER_RTPLUS_INFO_HOROSCOPE = 17,
+    RDSPARSER_RTPLUS_INFO_DAILY_DIVERSION = 18,
+    RDSPARSER_RTPLUS_INFO_HEALTH = 19,
+    RDSPARSER_RTPLUS_INFO_EVENT = 20,
+    RDSPARSER_RTPLUS_INFO_SCENE = 21,
+    RDSPARSER_RTPLUS_INFO_CINEMA = 22,
+    RDSPARSER_RTPLUS_INFO_STUPIDITY_MACHINE = 23,
+    RDSPARSER_RTPLUS_INFO_DATE_TIME = 24,
+    RDSPARSER_RTPLUS_INFO_WEATHER = 25,
+    RDSPARSER_RTPLUS_INFO_TRAFFIC = 26,
+    RDSPARSER_RTPLUS_INFO_ALARM = 27,
+    RDSPARSER_RTPLUS_INFO_ADVERTISEMENT = 28,
+    RDSPARSER_RTPLUS_INFO_URL = 29,
+    RDSPARSER_RTPLUS_INFO_OTHER = 30,
+    RDSPARSER_RTPLUS_STATIONNAME_SHORT = 31,
+    RDSPARSER_RTPLUS_STATIONNAME_LONG = 32,
+    RDSPARSER_RTPLUS_PROGRAMME_NOW = 33,
+    RDSPARSER_RTPLUS_PROGRAMME_NEXT = 34,
+    RDSPARSER_RTPLUS_PROGRAMME_PART = 35,
+    RDSPARSER_RTPLUS_PROGRAMME_HOST = 36,
+    RDSPARSER_RTPLUS_PROGRAMME_EDITORIAL_STAFF = 37,
+    RDSPARSER_RTPLUS_PROGRAMME_FREQUENCY = 38,
+    RDSPARSER_RTPLUS_PROGRAMME_HOMEPAGE = 39,
+    RDSPARSER_RTPLUS_PROGRAMME_SUBCHANNEL = 40,
+    RDSPARSER_RTPLUS_PHONE_HOTLINE = 41,
+    RDSPARSER_RTPLUS_PHONE_STUDIO = 42,
+    RDSPARSER_RTPLUS_PHONE_OTHER = 43,
+    RDSPARSER_RTPLUS_SMS_STUDIO = 44,
+    RDSPARSER_RTPLUS_SMS_OTHER = 45,
+    RDSPARSER_RTPLUS_EMAIL_HOTLINE = 46,
+    RDSPARSER_RTPLUS_EMAIL_STUDIO = 47,
+    RDSPARSER_RTPLUS_EMAIL_OTHER = 48,
+    RDSPARSER_RTPLUS_MMS_OTHER = 49,
+    RDSPARSER_RTPLUS_CHAT = 50,
+    RDSPARSER_RTPLUS_CHAT_CENTRE = 51,
+    RDSPARSER_RTPLUS_VOTE_QUESTION = 52,
+    RDSPARSER_RTPLUS_VOTE_CENTRE = 53,
+    RDSPARSER_RTPLUS_PLACE = 59,
+    RDSPARSER_RTPLUS_APPOINTMENT = 60,
+    RDSPARSER_RTPLUS_IDENTIFIER = 61,
+    RDSPARSER_RTPLUS_PURCHASE = 62,
+    RDSPARSER_RTPLUS_GET_DATA = 63,
+    RDSPARSER_RTPLUS_TYPE_COUNT
+};
+
 typedef struct librdsparser rdsparser_t;
+
+#ifndef RDSPARSER_DISABLE_UNICODE
+#include <wchar.h>
+typedef wchar_t rdsparser_string_char_t;
+#else
+typedef uint8_t rdsparser_string_char_t;
+#endif
+
+typedef struct rdsparser_event
+{
+    rdsparser_event_type_t type;
+    /* RT flag, SLC variant, ODA group (group << 1 | flag), RT+ type, CT offset, EON TA */
+    uint8_t index;
+    /* Changed range of a string or an RT+ tag */
+    uint8_t start;
+    uint8_t length;
+    /* Field value, AF frequency, CT epoch, EON PI, ODA AID or RT+ flag */
+    int64_t value;
+    /* Characters of the changed range of a string */
+    rdsparser_string_char_t text[RDSPARSER_EVENT_TEXT_LENGTH];
+} rdsparser_event_t;
 typedef uint16_t rdsparser_data_t[RDSPARSER_BLOCK_COUNT];
 typedef uint8_t rdsparser_error_t[RDSPARSER_BLOCK_COUNT];
+typedef void (*rdsparser_oda_callback_t)(rdsparser_t*, uint16_t, const rdsparser_data_t, const rdsparser_error_t, void*);
 
 typedef int32_t rdsparser_pi_t;
 #define RDSPARSER_PI_UNKNOWN -1
@@ -125,6 +314,34 @@ enum rdsparser_ms
 typedef int16_t rdsparser_ecc_t;
 #define RDSPARSER_ECC_UNKNOWN -1
 
+typedef int32_t rdsparser_pin_t;
+#define RDSPARSER_PIN_UNKNOWN -1
+
+typedef int8_t rdsparser_la_t;
+enum rdsparser_la
+{
+    RDSPARSER_LA_UNKNOWN = -1,
+    RDSPARSER_LA_OFF = 0,
+    RDSPARSER_LA_ON = 1
+};
+
+typedef int16_t rdsparser_slc_t;
+#define RDSPARSER_SLC_UNKNOWN -1
+
+typedef uint8_t rdsparser_slc_variant_t;
+enum rdsparser_slc_variant
+{
+    RDSPARSER_SLC_PAGING_ECC = 0,
+    RDSPARSER_SLC_TMC_ID = 1,
+    RDSPARSER_SLC_PAGING_ID = 2,
+    RDSPARSER_SLC_LANGUAGE = 3,
+    RDSPARSER_SLC_UNASSIGNED_4 = 4,
+    RDSPARSER_SLC_UNASSIGNED_5 = 5,
+    RDSPARSER_SLC_BROADCASTER = 6,
+    RDSPARSER_SLC_EWS = 7,
+    RDSPARSER_SLC_VARIANT_COUNT
+};
+
 typedef uint8_t rdsparser_country_t;
 enum rdsparser_country
 {
@@ -354,81 +571,264 @@ enum rdsparser_country
 
 typedef struct rdsparser_af rdsparser_af_t;
 typedef struct rdsparser_ct rdsparser_ct_t;
+typedef struct rdsparser_eon rdsparser_eon_t;
+typedef struct rdsparser_rtplus_tag rdsparser_rtplus_tag_t;
+
+typedef struct rdsparser_tmc_message
+{
+    uint16_t event;
+    uint16_t location;
+    uint8_t extent;
+    uint8_t duration;
+    bool direction;
+    bool diversion;
+    bool multi_group;
+} rdsparser_tmc_message_t;
+
+typedef struct rdsparser_log_writer
+{
+    FILE *file;
+    uint64_t time;
+    uint16_t sync_interval;
+    uint16_t records;
+} rdsparser_log_writer_t;
+
+typedef struct rdsparser_log_reader
+{
+    const uint8_t *data;
+    size_t length;
+    size_t offset;
+    uint64_t time;
+    uint16_t sync_interval;
+    uint16_t records;
+} rdsparser_log_reader_t;
+
+/* Callbacks, can be shared by any number of contexts */
+typedef struct rdsparser_handlers
+{
+    void (*pi)(rdsparser_t*, void*);
+    void (*pty)(rdsparser_t*, void*);
+    void (*tp)(rdsparser_t*, void*);
+    void (*ta)(rdsparser_t*, void*);
+    void (*ms)(rdsparser_t*, void*);
+    void (*ecc)(rdsparser_t*, void*);
+    void (*country)(rdsparser_t*, void*);
+    void (*pin)(rdsparser_t*, void*);
+    void (*la)(rdsparser_t*, void*);
+    void (*slc)(rdsparser_t*, rdsparser_slc_variant_t, void*);
+    void (*af)(rdsparser_t*, uint32_t, void*);
+    void (*af_expire)(rdsparser_t*, uint32_t, void*);
+    void (*ps)(rdsparser_t*, void*);
+    void (*rt)(rdsparser_t*, rdsparser_rt_flag_t, void*);
+    void (*rt_complete)(rdsparser_t*, rdsparser_rt_flag_t, void*);
+    void (*ptyn)(rdsparser_t*, void*);
+    void (*lps)(rdsparser_t*, void*);
+    void (*ert)(rdsparser_t*, void*);
+    void (*ct)(rdsparser_t*, const rdsparser_ct_t*, void*);
+    void (*eon)(rdsparser_t*, const rdsparser_eon_t*, void*);
+    void (*eon_ta)(rdsparser_t*, const rdsparser_eon_t*, void*);
+    void (*rtplus)(rdsparser_t*, const rdsparser_rtplus_tag_t*, void*);
+    void (*oda_announce)(rdsparser_t*, uint8_t, bool, uint16_t, void*);
+    void (*tmc)(rdsparser_t*, void*);
+} rdsparser_handlers_t;
 
-#ifndef RDSPARSER_DISABLE_UNICODE
-#include <wchar.h>
-typedef wchar_t rdsparser_string_char_t;
-#else
-typedef uint8_t rdsparser_string_char_t;
-#endif
 typedef rdsparser_string_char_t rdsparser_string_t;
 
 #ifndef RDSPARSER_DISABLE_HEAP
-rdsparser_t* rdsparser_new(void);
-void rdsparser_free(rdsparser_t *rds);
+RDSPARSER_API rdsparser_t* rdsparser_new(void);
+RDSPARSER_API void rdsparser_free(rdsparser_t *rds);
 #else
 #include <librdsparser_private.h>
 #endif
 
-void rdsparser_init(rdsparser_t *rds);
-void rdsparser_clear(rdsparser_t *rds);
-
-void rdsparser_parse(rdsparser_t *rds, rdsparser_data_t data, rdsparser_error_t errors);
-bool rdsparser_parse_string(rdsparser_t *rds, const char *input);
-
-void rdsparser_set_extended_check(rdsparser_t *rds, bool value);
-bool rdsparser_get_extended_check(const rdsparser_t *rds);
-
-void rdsparser_set_text_correction(rdsparser_t *rds, rdsparser_text_t text, rdsparser_block_type_t type, rdsparser_block_error_t error);
-rdsparser_block_error_t rdsparser_get_text_correction(const rdsparser_t *rds, rdsparser_text_t text, rdsparser_block_type_t type);
-
-void rdsparser_set_text_progressive(rdsparser_t *rds, rdsparser_text_t string, bool state);
-bool rdsparser_get_text_progressive(const rdsparser_t *rds, rdsparser_text_t string);
-
-rdsparser_pi_t rdsparser_get_pi(const rdsparser_t *rds);
-rdsparser_pty_t rdsparser_get_pty(const rdsparser_t *rds);
-rdsparser_tp_t rdsparser_get_tp(const rdsparser_t *rds);
-rdsparser_ta_t rdsparser_get_ta(const rdsparser_t *rds);
-rdsparser_ms_t rdsparser_get_ms(const rdsparser_t *rds);
-rdsparser_ecc_t rdsparser_get_ecc(const rdsparser_t *rds);
-rdsparser_country_t rdsparser_get_country(const rdsparser_t *rds);
-const rdsparser_af_t* rdsparser_get_af(const rdsparser_t *rds);
-const rdsparser_string_t* rdsparser_get_ps(const rdsparser_t *rds);
-const rdsparser_string_t* rdsparser_get_rt(const rdsparser_t *rds, rdsparser_rt_flag_t flag);
-const rdsparser_string_t* rdsparser_get_ptyn(const rdsparser_t *rds);
-
-void rdsparser_set_user_data(rdsparser_t *rds, void *user_data);
-
-void rdsparser_register_pi(rdsparser_t *rds, void (*callback_pi)(rdsparser_t*, void*));
-void rdsparser_register_pty(rdsparser_t *rds, void (*callback_pty)(rdsparser_t*, void*));
-void rdsparser_register_tp(rdsparser_t *rds, void (*callback_tp)(rdsparser_t*, void*));
-void rdsparser_register_ta(rdsparser_t *rds, void (*callback_ta)(rdsparser_t*, void*));
-void rdsparser_register_ms(rdsparser_t *rds, void (*callback_ms)(rdsparser_t*, void*));
-void rdsparser_register_ecc(rdsparser_t *rds, void (*callback_ecc)(rdsparser_t*, void*));
-void rdsparser_register_country(rdsparser_t *rds, void (*callback_country)(rdsparser_t*, void*));
-void rdsparser_register_af(rdsparser_t *rds, void (*callback_af)(rdsparser_t*, uint32_t, void*));
-void rdsparser_register_ps(rdsparser_t *rds, void (*callback_ps)(rdsparser_t*, void*));
-void rdsparser_register_rt(rdsparser_t *rds, void (*callback_rt)(rdsparser_t*, rdsparser_rt_flag_t, void*));
-void rdsparser_register_ptyn(rdsparser_t *rds, void (*callback_ptyn)(rdsparser_t*, void*));
-void rdsparser_register_ct(rdsparser_t *rds, void (*callback_ct)(rdsparser_t*, const rdsparser_ct_t*, void*));
-
-uint8_t rdsparser_string_get_length(const rdsparser_string_t *string);
-bool rdsparser_string_get_available(const rdsparser_string_t *string);
-const rdsparser_string_char_t* rdsparser_string_get_content(const rdsparser_string_t *string);
-const rdsparser_string_error_t* rdsparser_string_get_errors(const rdsparser_string_t *string);
-
-uint16_t rdsparser_ct_get_year(const rdsparser_ct_t *ct);
-uint8_t rdsparser_ct_get_month(const rdsparser_ct_t *ct);
-uint8_t rdsparser_ct_get_day(const rdsparser_ct_t *ct);
-uint8_t rdsparser_ct_get_hour(const rdsparser_ct_t *ct);
-uint8_t rdsparser_ct_get_minute(const rdsparser_ct_t *ct);
-int16_t rdsparser_ct_get_offset(const rdsparser_ct_t *ct);
-
-const char* rdsparser_pty_lookup_name(rdsparser_pty_t pty, bool rbds);
-const char* rdsparser_pty_lookup_short(rdsparser_pty_t pty, bool rbds);
-const char* rdsparser_pty_lookup_long(rdsparser_pty_t pty, bool rbds);
-const char* rdsparser_country_lookup_name(rdsparser_country_t country);
-const char* rdsparser_country_lookup_iso(rdsparser_country_t country);
+RDSPARSER_API void rdsparser_init(rdsparser_t *rds);
+RDSPARSER_API void rdsparser_deinit(rdsparser_t *rds);
+RDSPARSER_API void rdsparser_clear(rdsparser_t *rds);
+
+RDSPARSER_API void rdsparser_parse(rdsparser_t *rds, rdsparser_data_t data, rdsparser_error_t errors);
+RDSPARSER_API void rdsparser_parse_ts(rdsparser_t *rds, rdsparser_data_t data, rdsparser_error_t errors, uint64_t now);
+RDSPARSER_API bool rdsparser_parse_string(rdsparser_t *rds, const char *input);
+RDSPARSER_API size_t rdsparser_parse_buffer(rdsparser_t *rds, const char *buffer, size_t length);
+RDSPARSER_API bool rdsparser_read_group(const char **input, const char *end, rdsparser_data_t data, rdsparser_error_t errors);
+RDSPARSER_API int64_t rdsparser_parse_log(rdsparser_t *rds, const uint8_t *buffer, size_t length);
+
+#ifndef RDSPARSER_DISABLE_FILE
+RDSPARSER_API int64_t rdsparser_parse_file(rdsparser_t *rds, const char *path);
+RDSPARSER_API bool rdsparser_file_map(const char *path, const char **data, size_t *length);
+RDSPARSER_API void rdsparser_file_unmap(const char *data, size_t length);
+#endif
+
+RDSPARSER_API void rdsparser_set_extended_check(rdsparser_t *rds, bool value);
+RDSPARSER_API bool rdsparser_get_extended_check(const rdsparser_t *rds);
+
+RDSPARSER_API void rdsparser_set_text_correction(rdsparser_t *rds, rdsparser_text_t text, rdsparser_block_type_t type, rdsparser_block_error_t error);
+RDSPARSER_API rdsparser_block_error_t rdsparser_get_text_correction(const rdsparser_t *rds, rdsparser_text_t text, rdsparser_block_type_t type);
+
+RDSPARSER_API void rdsparser_set_text_progressive(rdsparser_t *rds, rdsparser_text_t string, bool state);
+RDSPARSER_API bool rdsparser_get_text_progressive(const rdsparser_t *rds, rdsparser_text_t string);
+
+RDSPARSER_API bool rdsparser_set_text_enabled(rdsparser_t *rds, rdsparser_text_t text, bool state);
+RDSPARSER_API bool rdsparser_get_text_enabled(const rdsparser_t *rds, rdsparser_text_t text);
+
+RDSPARSER_API void rdsparser_set_time(rdsparser_t *rds, uint64_t now);
+RDSPARSER_API uint64_t rdsparser_get_time(const rdsparser_t *rds);
+
+RDSPARSER_API void rdsparser_set_ttl(rdsparser_t *rds, rdsparser_field_t field, uint32_t ttl);
+RDSPARSER_API uint32_t rdsparser_get_ttl(const rdsparser_t *rds, rdsparser_field_t field);
+RDSPARSER_API uint64_t rdsparser_get_last_seen(const rdsparser_t *rds, rdsparser_field_t field);
+RDSPARSER_API void rdsparser_expire(rdsparser_t *rds, uint64_t now);
+
+#ifndef RDSPARSER_DISABLE_AF
+RDSPARSER_API void rdsparser_set_af_ageing(rdsparser_t *rds, bool state);
+RDSPARSER_API bool rdsparser_get_af_ageing(const rdsparser_t *rds);
+RDSPARSER_API void rdsparser_af_expire(rdsparser_t *rds, uint64_t now, uint32_t max_age);
+RDSPARSER_API uint16_t rdsparser_get_af_hits(const rdsparser_t *rds, uint32_t frequency);
+RDSPARSER_API uint64_t rdsparser_get_af_last_seen(const rdsparser_t *rds, uint32_t frequency);
+#endif
+
+#ifndef RDSPARSER_DISABLE_GROUP4
+RDSPARSER_API void rdsparser_set_ct_filter(rdsparser_t *rds, bool state);
+RDSPARSER_API bool rdsparser_get_ct_filter(const rdsparser_t *rds);
+#endif
+
+RDSPARSER_API void rdsparser_set_rt_complete_threshold(rdsparser_t *rds, rdsparser_string_error_t error);
+RDSPARSER_API rdsparser_string_error_t rdsparser_get_rt_complete_threshold(const rdsparser_t *rds);
+
+RDSPARSER_API void rdsparser_set_tmc_window(rdsparser_t *rds, uint32_t groups);
+RDSPARSER_API uint32_t rdsparser_get_tmc_window(const rdsparser_t *rds);
+
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+RDSPARSER_API bool rdsparser_set_station_cache(rdsparser_t *rds, rdsparser_station_cache_t mode);
+RDSPARSER_API rdsparser_station_cache_t rdsparser_get_station_cache(const rdsparser_t *rds);
+RDSPARSER_API void rdsparser_set_frequency(rdsparser_t *rds, uint32_t frequency);
+RDSPARSER_API uint32_t rdsparser_get_frequency(const rdsparser_t *rds);
+RDSPARSER_API uint8_t rdsparser_get_station_cache_count(const rdsparser_t *rds);
+RDSPARSER_API void rdsparser_clear_station_cache(rdsparser_t *rds);
+#endif
+
+RDSPARSER_API bool rdsparser_set_events(rdsparser_t *rds, bool state);
+RDSPARSER_API bool rdsparser_get_events(const rdsparser_t *rds);
+RDSPARSER_API bool rdsparser_pop_event(rdsparser_t *rds, rdsparser_event_t *event);
+RDSPARSER_API size_t rdsparser_poll_events(rdsparser_t *rds, rdsparser_event_t *out, size_t cap);
+RDSPARSER_API uint32_t rdsparser_get_event_overflow(const rdsparser_t *rds);
+
+RDSPARSER_API size_t rdsparser_write_json(rdsparser_t *rds, char *buffer, size_t size, unsigned flags);
+RDSPARSER_API size_t rdsparser_write_json_delta(rdsparser_t *rds, char *buffer, size_t size, unsigned flags);
+
+RDSPARSER_API rdsparser_pi_t rdsparser_get_pi(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_pty_t rdsparser_get_pty(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_tp_t rdsparser_get_tp(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_ta_t rdsparser_get_ta(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_ms_t rdsparser_get_ms(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_ecc_t rdsparser_get_ecc(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_country_t rdsparser_get_country(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_pin_t rdsparser_get_pin(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_la_t rdsparser_get_la(const rdsparser_t *rds);
+RDSPARSER_API rdsparser_slc_t rdsparser_get_slc(const rdsparser_t *rds, rdsparser_slc_variant_t variant);
+RDSPARSER_API const rdsparser_af_t* rdsparser_get_af(const rdsparser_t *rds);
+RDSPARSER_API const rdsparser_string_t* rdsparser_get_ps(const rdsparser_t *rds);
+RDSPARSER_API const rdsparser_string_t* rdsparser_get_rt(const rdsparser_t *rds, rdsparser_rt_flag_t flag);
+RDSPARSER_API bool rdsparser_get_rt_complete(const rdsparser_t *rds, rdsparser_rt_flag_t flag);
+RDSPARSER_API const rdsparser_string_t* rdsparser_get_ptyn(const rdsparser_t *rds);
+RDSPARSER_API const rdsparser_string_t* rdsparser_get_lps(const rdsparser_t *rds);
+RDSPARSER_API const rdsparser_string_t* rdsparser_get_ert(const rdsparser_t *rds);
+RDSPARSER_API uint8_t rdsparser_get_eon_count(const rdsparser_t *rds);
+RDSPARSER_API const rdsparser_eon_t* rdsparser_get_eon(const rdsparser_t *rds, uint8_t index);
+RDSPARSER_API const rdsparser_eon_t* rdsparser_get_eon_pi(const rdsparser_t *rds, rdsparser_pi_t pi);
+RDSPARSER_API bool rdsparser_get_rtplus_running(const rdsparser_t *rds);
+RDSPARSER_API uint8_t rdsparser_get_rtplus_count(const rdsparser_t *rds);
+RDSPARSER_API const rdsparser_rtplus_tag_t* rdsparser_get_rtplus(const rdsparser_t *rds, uint8_t index);
+RDSPARSER_API const rdsparser_rtplus_tag_t* rdsparser_get_rtplus_type(const rdsparser_t *rds, rdsparser_rtplus_type_t type);
+RDSPARSER_API uint16_t rdsparser_get_oda(const rdsparser_t *rds, uint8_t group, bool flag);
+RDSPARSER_API uint8_t rdsparser_get_tmc_pending(const rdsparser_t *rds);
+RDSPARSER_API uint32_t rdsparser_get_tmc_overflow(const rdsparser_t *rds);
+RDSPARSER_API size_t rdsparser_tmc_drain(rdsparser_t *rds, rdsparser_tmc_message_t *out, size_t cap);
+
+RDSPARSER_API void rdsparser_set_user_data(rdsparser_t *rds, void *user_data);
+RDSPARSER_API void* rdsparser_get_user_data(const rdsparser_t *rds);
+RDSPARSER_API void rdsparser_set_handlers(rdsparser_t *rds, const rdsparser_handlers_t *handlers);
+RDSPARSER_API const rdsparser_handlers_t* rdsparser_get_handlers(const rdsparser_t *rds);
+
+RDSPARSER_API void rdsparser_register_pi(rdsparser_t *rds, void (*callback_pi)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_pty(rdsparser_t *rds, void (*callback_pty)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_tp(rdsparser_t *rds, void (*callback_tp)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_ta(rdsparser_t *rds, void (*callback_ta)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_ms(rdsparser_t *rds, void (*callback_ms)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_ecc(rdsparser_t *rds, void (*callback_ecc)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_country(rdsparser_t *rds, void (*callback_country)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_pin(rdsparser_t *rds, void (*callback_pin)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_la(rdsparser_t *rds, void (*callback_la)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_slc(rdsparser_t *rds, void (*callback_slc)(rdsparser_t*, rdsparser_slc_variant_t, void*));
+RDSPARSER_API void rdsparser_register_af(rdsparser_t *rds, void (*callback_af)(rdsparser_t*, uint32_t, void*));
+RDSPARSER_API void rdsparser_register_af_expire(rdsparser_t *rds, void (*callback_af_expire)(rdsparser_t*, uint32_t, void*));
+RDSPARSER_API void rdsparser_register_ps(rdsparser_t *rds, void (*callback_ps)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_rt(rdsparser_t *rds, void (*callback_rt)(rdsparser_t*, rdsparser_rt_flag_t, void*));
+RDSPARSER_API void rdsparser_register_rt_complete(rdsparser_t *rds, void (*callback_rt_complete)(rdsparser_t*, rdsparser_rt_flag_t, void*));
+RDSPARSER_API void rdsparser_register_ptyn(rdsparser_t *rds, void (*callback_ptyn)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_lps(rdsparser_t *rds, void (*callback_lps)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_ert(rdsparser_t *rds, void (*callback_ert)(rdsparser_t*, void*));
+RDSPARSER_API void rdsparser_register_ct(rdsparser_t *rds, void (*callback_ct)(rdsparser_t*, const rdsparser_ct_t*, void*));
+RDSPARSER_API void rdsparser_register_eon(rdsparser_t *rds, void (*callback_eon)(rdsparser_t*, const rdsparser_eon_t*, void*));
+RDSPARSER_API void rdsparser_register_eon_ta(rdsparser_t *rds, void (*callback_eon_ta)(rdsparser_t*, const rdsparser_eon_t*, void*));
+RDSPARSER_API void rdsparser_register_rtplus(rdsparser_t *rds, void (*callback_rtplus)(rdsparser_t*, const rdsparser_rtplus_tag_t*, void*));
+RDSPARSER_API void rdsparser_register_oda_announce(rdsparser_t *rds, void (*callback_oda)(rdsparser_t*, uint8_t, bool, uint16_t, void*));
+RDSPARSER_API bool rdsparser_register_oda(rdsparser_t *rds, uint16_t aid, rdsparser_oda_callback_t callback);
+RDSPARSER_API void rdsparser_register_tmc(rdsparser_t *rds, void (*callback_tmc)(rdsparser_t*, void*));
+
+RDSPARSER_API uint8_t rdsparser_string_get_length(const rdsparser_string_t *string);
+RDSPARSER_API bool rdsparser_string_get_available(const rdsparser_string_t *string);
+RDSPARSER_API const rdsparser_string_char_t* rdsparser_string_get_content(const rdsparser_string_t *string);
+RDSPARSER_API const rdsparser_string_error_t* rdsparser_string_get_errors(const rdsparser_string_t *string);
+RDSPARSER_API rdsparser_string_encoding_t rdsparser_string_get_encoding(const rdsparser_string_t *string);
+RDSPARSER_API size_t rdsparser_string_get_utf8(const rdsparser_string_t *string, char *output, size_t size);
+
+#ifndef RDSPARSER_DISABLE_GROUP4
+RDSPARSER_API void rdsparser_ct_get_date(const rdsparser_ct_t *ct, uint16_t *year, uint8_t *month, uint8_t *day);
+RDSPARSER_API uint16_t rdsparser_ct_get_year(const rdsparser_ct_t *ct);
+RDSPARSER_API uint8_t rdsparser_ct_get_month(const rdsparser_ct_t *ct);
+RDSPARSER_API uint8_t rdsparser_ct_get_day(const rdsparser_ct_t *ct);
+RDSPARSER_API uint8_t rdsparser_ct_get_hour(const rdsparser_ct_t *ct);
+RDSPARSER_API uint8_t rdsparser_ct_get_minute(const rdsparser_ct_t *ct);
+RDSPARSER_API int16_t rdsparser_ct_get_offset(const rdsparser_ct_t *ct);
+RDSPARSER_API int64_t rdsparser_ct_get_epoch(const rdsparser_ct_t *ct);
+#endif
+
+RDSPARSER_API bool rdsparser_log_writer_init(rdsparser_log_writer_t *writer, FILE *file, uint16_t sync_interval);
+RDSPARSER_API bool rdsparser_log_write(rdsparser_log_writer_t *writer, uint64_t time, const rdsparser_data_t data, const rdsparser_error_t errors);
+RDSPARSER_API bool rdsparser_log_reader_init(rdsparser_log_reader_t *reader, const uint8_t *buffer, size_t length);
+RDSPARSER_API bool rdsparser_log_read(rdsparser_log_reader_t *reader, rdsparser_data_t data, rdsparser_error_t errors, uint64_t *time);
+
+#ifndef RDSPARSER_DISABLE_GROUP1
+RDSPARSER_API uint8_t rdsparser_pin_get_day(rdsparser_pin_t pin);
+RDSPARSER_API uint8_t rdsparser_pin_get_hour(rdsparser_pin_t pin);
+RDSPARSER_API uint8_t rdsparser_pin_get_minute(rdsparser_pin_t pin);
+#endif
+
+RDSPARSER_API rdsparser_pi_t rdsparser_eon_get_pi(const rdsparser_eon_t *eon);
+RDSPARSER_API rdsparser_pty_t rdsparser_eon_get_pty(const rdsparser_eon_t *eon);
+RDSPARSER_API rdsparser_tp_t rdsparser_eon_get_tp(const rdsparser_eon_t *eon);
+RDSPARSER_API rdsparser_ta_t rdsparser_eon_get_ta(const rdsparser_eon_t *eon);
+RDSPARSER_API const rdsparser_af_t* rdsparser_eon_get_af(const rdsparser_eon_t *eon);
+RDSPARSER_API const rdsparser_string_t* rdsparser_eon_get_ps(const rdsparser_eon_t *eon);
+RDSPARSER_API uint32_t rdsparser_eon_get_mapped(const rdsparser_eon_t *eon, uint32_t frequency);
+
+RDSPARSER_API rdsparser_rtplus_type_t rdsparser_rtplus_tag_get_type(const rdsparser_rtplus_tag_t *tag);
+RDSPARSER_API uint8_t rdsparser_rtplus_tag_get_start(const rdsparser_rtplus_tag_t *tag);
+RDSPARSER_API uint8_t rdsparser_rtplus_tag_get_length(const rdsparser_rtplus_tag_t *tag);
+RDSPARSER_API rdsparser_rt_flag_t rdsparser_rtplus_tag_get_flag(const rdsparser_rtplus_tag_t *tag);
+RDSPARSER_API const rdsparser_string_char_t* rdsparser_rtplus_tag_get_content(const rdsparser_t *rds, const rdsparser_rtplus_tag_t *tag);
+
+RDSPARSER_API uint8_t rdsparser_af_count(const rdsparser_af_t *af);
+RDSPARSER_API uint32_t rdsparser_af_next(const rdsparser_af_t *af, uint32_t prev);
+RDSPARSER_API size_t rdsparser_af_to_array(const rdsparser_af_t *af, uint32_t *khz, size_t cap);
+
+#ifndef RDSPARSER_DISABLE_LOOKUPS
+RDSPARSER_API const char* rdsparser_pty_lookup_name(rdsparser_pty_t pty, bool rbds);
+RDSPARSER_API const char* rdsparser_pty_lookup_short(rdsparser_pty_t pty, bool rbds);
+RDSPARSER_API const char* rdsparser_pty_lookup_long(rdsparser_pty_t pty, bool rbds);
+RDSPARSER_API const char* rdsparser_country_lookup_name(rdsparser_country_t country);
+RDSPARSER_API const char* rdsparser_country_lookup_iso(rdsparser_country_t country);
+#endif
 
 #ifdef __cplusplus
 }
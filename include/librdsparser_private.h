@@ -20,8 +20,17 @@
 #include <stdbool.h>
 #include <librdsparser.h>
 
-#define RDSPARSER_STRING_SIZE(len) (1 + (len) + 1 + \
-                              (len) / sizeof(rdsparser_string_char_t))
+#define RDSPARSER_STRING_SIZE(len) (2 + (len) + 1 + \
+                              ((len) + sizeof(rdsparser_string_char_t) - 1) / sizeof(rdsparser_string_char_t))
+
+/* RadioText buffer used for the A/B flag */
+#ifdef RDSPARSER_DISABLE_RT_B
+#define RDSPARSER_RT_BUFFER_COUNT 1
+#define RDSPARSER_RT_BUFFER(flag) 0
+#else
+#define RDSPARSER_RT_BUFFER_COUNT RDSPARSER_RT_FLAG_COUNT
+#define RDSPARSER_RT_BUFFER(flag) (flag)
+#endif
 
 typedef enum rdsparser_group_flag
 {
@@ -29,11 +38,163 @@ typedef enum rdsparser_group_flag
     RDSPARSER_GROUP_FLAG_B = 1
 } rdsparser_group_flag_t;
 
+/* One bit for each of the 204 AF codes */
+#define RDSPARSER_AF_BITMAP_WORDS 4
+
 typedef struct rdsparser_af
 {
-    uint8_t buffer[RDSPARSER_AF_BUFFER_SIZE];
+    uint64_t buffer[RDSPARSER_AF_BITMAP_WORDS];
 } rdsparser_af_t;
 
+typedef struct rdsparser_af_table
+{
+    uint64_t last_seen[RDSPARSER_AF_TABLE_SIZE];
+    uint16_t hits[RDSPARSER_AF_TABLE_SIZE];
+} rdsparser_af_table_t;
+
+typedef struct rdsparser_eon
+{
+    rdsparser_pi_t pi;
+    rdsparser_pty_t pty;
+    rdsparser_tp_t tp;
+    rdsparser_ta_t ta;
+    uint8_t mapping[RDSPARSER_EON_MAPPING_SIZE][2];
+    rdsparser_af_t af;
+    rdsparser_string_t ps[RDSPARSER_STRING_SIZE(RDSPARSER_PS_LENGTH)];
+} rdsparser_eon_t;
+
+typedef struct rdsparser_eon_table
+{
+    rdsparser_eon_t entry[RDSPARSER_EON_TABLE_SIZE];
+    uint8_t order[RDSPARSER_EON_TABLE_SIZE];
+    uint8_t count;
+} rdsparser_eon_table_t;
+
+typedef struct rdsparser_rtplus_tag
+{
+    rdsparser_rtplus_type_t type;
+    uint8_t start;
+    uint8_t length;
+    rdsparser_rt_flag_t flag;
+} rdsparser_rtplus_tag_t;
+
+typedef struct rdsparser_rtplus
+{
+    int8_t toggle;
+    bool running;
+    rdsparser_rtplus_tag_t tag[RDSPARSER_RTPLUS_TAG_COUNT];
+    uint8_t count;
+} rdsparser_rtplus_t;
+
+#define RDSPARSER_ODA_GROUP_COUNT 32
+#define RDSPARSER_ODA_AID_NONE 0x0000
+
+typedef struct rdsparser_oda_group
+{
+    uint16_t aid;
+    int8_t handler;
+} rdsparser_oda_group_t;
+
+typedef struct rdsparser_oda_handler
+{
+    uint16_t aid;
+    rdsparser_oda_callback_t callback;
+} rdsparser_oda_handler_t;
+
+typedef struct rdsparser_oda
+{
+    rdsparser_oda_group_t group[RDSPARSER_ODA_GROUP_COUNT];
+    rdsparser_oda_handler_t handler[RDSPARSER_ODA_HANDLER_COUNT];
+    uint8_t handler_count;
+} rdsparser_oda_t;
+
+/* Queue size has to be a power of two, up to 128 */
+#define RDSPARSER_TMC_HASH_BITS 5
+#define RDSPARSER_TMC_HASH_SIZE (1 << RDSPARSER_TMC_HASH_BITS)
+#define RDSPARSER_TMC_FREE_COUNT 4
+
+typedef struct rdsparser_tmc
+{
+    /* Recently seen messages, with the group count of the last repeat */
+    uint64_t hash[RDSPARSER_TMC_HASH_SIZE];
+    uint32_t seen[RDSPARSER_TMC_HASH_SIZE];
+    rdsparser_tmc_message_t queue[RDSPARSER_TMC_QUEUE_SIZE];
+    uint8_t head;
+    uint8_t tail;
+    uint32_t overflow;
+
+    /* Multi-group message assembly */
+    rdsparser_tmc_message_t pending;
+    int8_t ci;
+    uint8_t gsi;
+    uint8_t free_count;
+    uint32_t free[RDSPARSER_TMC_FREE_COUNT];
+    /* Last group, with the TMC bits of block B */
+    uint8_t last_b;
+    uint16_t last_c;
+    uint16_t last_d;
+} rdsparser_tmc_t;
+
+typedef struct rdsparser_rt_state
+{
+    uint16_t segments;
+    bool complete;
+} rdsparser_rt_state_t;
+
+typedef struct rdsparser_ct_filter
+{
+    bool valid;
+    int64_t epoch;
+    uint32_t groups;
+} rdsparser_ct_filter_t;
+
+typedef struct rdsparser_ttl
+{
+    uint32_t ttl[RDSPARSER_FIELD_COUNT];
+    uint64_t last_seen[RDSPARSER_FIELD_COUNT];
+    uint64_t deadline;
+} rdsparser_ttl_t;
+
+typedef struct rdsparser_station
+{
+    rdsparser_pi_t pi;
+    uint32_t frequency;
+    rdsparser_af_t af;
+    rdsparser_string_t ps[RDSPARSER_STRING_SIZE(RDSPARSER_PS_LENGTH)];
+    rdsparser_string_t rt[RDSPARSER_RT_BUFFER_COUNT][RDSPARSER_STRING_SIZE(RDSPARSER_RT_LENGTH)];
+    rdsparser_string_t ptyn[RDSPARSER_STRING_SIZE(RDSPARSER_PTYN_LENGTH)];
+} rdsparser_station_t;
+
+typedef struct rdsparser_station_table
+{
+    rdsparser_station_t entry[RDSPARSER_STATION_CACHE_SIZE];
+    /* Most recently used first */
+    uint8_t order[RDSPARSER_STATION_CACHE_SIZE];
+    uint8_t count;
+} rdsparser_station_table_t;
+
+typedef struct rdsparser_event_queue
+{
+    rdsparser_event_t *event;
+    /* Written by the parser */
+    uint32_t head;
+    /* Written by the consumer */
+    uint32_t tail;
+    uint32_t overflow;
+    /* Changed range of each text since its last event */
+    uint8_t range[RDSPARSER_TEXT_COUNT][2];
+} rdsparser_event_queue_t;
+
+typedef struct rdsparser_json
+{
+    /* Fields changed since the last written JSON */
+    uint32_t dirty;
+    /* Last received CT */
+    bool ct;
+    int64_t ct_epoch;
+    int16_t ct_offset;
+} rdsparser_json_t;
+
 typedef struct rdsparser_buffer_data
 {
     rdsparser_pi_t pi;
@@ -43,6 +204,9 @@ typedef struct rdsparser_buffer_data
     rdsparser_ms_t ms;
     rdsparser_ecc_t ecc;
     rdsparser_country_t country;
+    rdsparser_pin_t pin;
+    rdsparser_la_t la;
+    rdsparser_slc_t slc[RDSPARSER_SLC_VARIANT_COUNT];
     rdsparser_af_t af;
 } rdsparser_buffer_data_t;
 
@@ -58,30 +222,62 @@ struct librdsparser
     /* Data buffers */
     rdsparser_buffer_t buffer;
     rdsparser_string_t ps[RDSPARSER_STRING_SIZE(RDSPARSER_PS_LENGTH)];
-    rdsparser_string_t rt[RDSPARSER_RT_FLAG_COUNT][RDSPARSER_STRING_SIZE(RDSPARSER_RT_LENGTH)];
+    rdsparser_string_t rt[RDSPARSER_RT_BUFFER_COUNT][RDSPARSER_STRING_SIZE(RDSPARSER_RT_LENGTH)];
     rdsparser_string_t ptyn[RDSPARSER_STRING_SIZE(RDSPARSER_PTYN_LENGTH)];
+    rdsparser_string_t *lps;
+    rdsparser_string_t *ert;
+#ifdef RDSPARSER_DISABLE_HEAP
+    rdsparser_string_t lps_buffer[RDSPARSER_STRING_SIZE(RDSPARSER_LPS_LENGTH)];
+    rdsparser_string_t ert_buffer[RDSPARSER_STRING_SIZE(RDSPARSER_ERT_LENGTH)];
+    rdsparser_event_t events_buffer[RDSPARSER_EVENT_QUEUE_SIZE];
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    rdsparser_station_table_t stations_buffer;
+#endif
+#endif
+    rdsparser_rt_state_t rt_state[RDSPARSER_RT_BUFFER_COUNT];
+#ifndef RDSPARSER_DISABLE_AF
+    rdsparser_af_table_t af_table;
+#endif
+    rdsparser_eon_table_t eon;
+    rdsparser_rtplus_t rtplus;
+    rdsparser_oda_t oda;
+    rdsparser_tmc_t tmc;
+#ifndef RDSPARSER_DISABLE_GROUP4
+    rdsparser_ct_filter_t ct_filter;
+#endif
+    rdsparser_ttl_t ttl;
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    /* Allocated only while the station cache is enabled */
+    rdsparser_station_table_t *stations;
+#endif
+    rdsparser_event_queue_t events;
+    rdsparser_json_t json;
 
     /* Settings */
     bool progressive[RDSPARSER_TEXT_COUNT];
     rdsparser_block_error_t correction[RDSPARSER_TEXT_COUNT][RDSPARSER_BLOCK_TYPE_COUNT];
+#ifndef RDSPARSER_DISABLE_AF
+    bool af_ageing;
+#endif
+#ifndef RDSPARSER_DISABLE_GROUP4
+    bool ct_filter_enabled;
+#endif
+    rdsparser_string_error_t rt_complete_threshold;
+    uint32_t tmc_window;
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    rdsparser_station_cache_t station_cache;
+    uint32_t frequency;
+#endif
 
-    /* Callbacks */
+    /* Callbacks, shared or owned by the context (after rdsparser_register_*) */
+    const rdsparser_handlers_t *handlers;
+    rdsparser_handlers_t handlers_own;
     void *user_data;
-    void (*callback_pi)(rdsparser_t*, void*);
-    void (*callback_pty)(rdsparser_t*, void*);
-    void (*callback_tp)(rdsparser_t*, void*);
-    void (*callback_ta)(rdsparser_t*, void*);
-    void (*callback_ms)(rdsparser_t*, void*);
-    void (*callback_ecc)(rdsparser_t*, void*);
-    void (*callback_country)(rdsparser_t*, void*);
-    void (*callback_af)(rdsparser_t*, uint32_t, void*);
-    void (*callback_ps)(rdsparser_t*, void*);
-    void (*callback_rt)(rdsparser_t*, rdsparser_rt_flag_t, void*);
-    void (*callback_ptyn)(rdsparser_t*, void*);
-    void (*callback_ct)(rdsparser_t*, const rdsparser_ct_t*, void*);
 
     /* Other data */
     int8_t last_rt_flag;
+    uint64_t time;
+    uint32_t groups;
 };
 
 #endif
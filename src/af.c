@@ -14,18 +14,65 @@
  *  Lesser General Public License for more details.
  */
 
+#include <stddef.h>
 #include <librdsparser_private.h>
+#include "af.h"
+
+#define RDSPARSER_AF_MIN 1
+#define RDSPARSER_AF_MAX 204
+#define RDSPARSER_AF_WORD_BITS 64
+
+#if defined(__GNUC__)
+#define rdsparser_af_popcount(x) ((uint8_t)__builtin_popcountll(x))
+#define rdsparser_af_ctz(x) ((uint8_t)__builtin_ctzll(x))
+#else
+static inline uint8_t
+rdsparser_af_popcount(uint64_t word)
+{
+    uint8_t count = 0;
+    while (word)
+    {
+        word &= word - 1;
+        count++;
+    }
+
+    return count;
+}
+
+static inline uint8_t
+rdsparser_af_ctz(uint64_t word)
+{
+    uint8_t count = 0;
+    while (!(word & 1))
+    {
+        word >>= 1;
+        count++;
+    }
+
+    return count;
+}
+#endif
+
+static inline uint8_t
+rdsparser_af_get_word(uint8_t value)
+{
+    return value / RDSPARSER_AF_WORD_BITS;
+}
+
+static inline uint64_t
+rdsparser_af_get_mask(uint8_t value)
+{
+    return (uint64_t)1 << (value % RDSPARSER_AF_WORD_BITS);
+}
 
 bool
 rdsparser_af_set(rdsparser_af_t *af,
                  uint8_t         value)
 {
-    if (value >= 1 &&
-        value <= 204)
+    if (value >= RDSPARSER_AF_MIN &&
+        value <= RDSPARSER_AF_MAX)
     {
-        const uint8_t pos = value / 8;
-        const uint8_t bitPos = value % 8;
-        af->buffer[pos] |= (0x80 >> bitPos);
+        af->buffer[rdsparser_af_get_word(value)] |= rdsparser_af_get_mask(value);
         return true;
     }
 
@@ -36,12 +83,23 @@ bool
 rdsparser_af_get(const rdsparser_af_t *af,
                  uint8_t               value)
 {
-    if (value >= 1 &&
-        value <= 204)
+    if (value >= RDSPARSER_AF_MIN &&
+        value <= RDSPARSER_AF_MAX)
     {
-        const uint8_t pos = value / 8;
-        const uint8_t bitPos = value % 8;
-        return af->buffer[pos] & (0x80 >> bitPos);
+        return af->buffer[rdsparser_af_get_word(value)] & rdsparser_af_get_mask(value);
+    }
+
+    return false;
+}
+
+bool
+rdsparser_af_unset(rdsparser_af_t *af,
+                   uint8_t         value)
+{
+    if (rdsparser_af_get(af, value))
+    {
+        af->buffer[rdsparser_af_get_word(value)] &= ~rdsparser_af_get_mask(value);
+        return true;
     }
 
     return false;
@@ -50,9 +108,135 @@ rdsparser_af_get(const rdsparser_af_t *af,
 void
 rdsparser_af_clear(rdsparser_af_t *af)
 {
-    for (uint8_t i = 0; i < RDSPARSER_AF_BUFFER_SIZE; i++)
+    for (uint8_t i = 0; i < RDSPARSER_AF_BITMAP_WORDS; i++)
     {
         af->buffer[i] = 0;
     }
 }
 
+uint32_t
+rdsparser_af_get_frequency(uint8_t value)
+{
+    return 87500 + (uint32_t)value * 100;
+}
+
+uint8_t
+rdsparser_af_get_value(uint32_t frequency)
+{
+    if (frequency < rdsparser_af_get_frequency(RDSPARSER_AF_MIN) ||
+        frequency > rdsparser_af_get_frequency(RDSPARSER_AF_MAX) ||
+        frequency % 100)
+    {
+        return 0;
+    }
+
+    return (uint8_t)((frequency - rdsparser_af_get_frequency(0)) / 100);
+}
+
+uint8_t
+rdsparser_af_count(const rdsparser_af_t *af)
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < RDSPARSER_AF_BITMAP_WORDS; i++)
+    {
+        count += rdsparser_af_popcount(af->buffer[i]);
+    }
+
+    return count;
+}
+
+uint32_t
+rdsparser_af_next(const rdsparser_af_t *af,
+                  uint32_t              prev)
+{
+    /* Start from the first code above the previous frequency */
+    uint8_t value = RDSPARSER_AF_MIN;
+    if (prev >= rdsparser_af_get_frequency(RDSPARSER_AF_MIN))
+    {
+        const uint32_t next = (prev - rdsparser_af_get_frequency(0)) / 100 + 1;
+        if (next > RDSPARSER_AF_MAX)
+        {
+            return 0;
+        }
+
+        value = (uint8_t)next;
+    }
+
+    uint8_t i = rdsparser_af_get_word(value);
+    uint64_t word = af->buffer[i] & ~(rdsparser_af_get_mask(value) - 1);
+
+    while (!word)
+    {
+        if (++i == RDSPARSER_AF_BITMAP_WORDS)
+        {
+            return 0;
+        }
+
+        word = af->buffer[i];
+    }
+
+    return rdsparser_af_get_frequency(i * RDSPARSER_AF_WORD_BITS + rdsparser_af_ctz(word));
+}
+
+size_t
+rdsparser_af_to_array(const rdsparser_af_t *af,
+                      uint32_t             *khz,
+                      size_t                cap)
+{
+    size_t count = 0;
+
+    for (uint8_t i = 0; i < RDSPARSER_AF_BITMAP_WORDS; i++)
+    {
+        uint64_t word = af->buffer[i];
+        while (word)
+        {
+            if (count == cap)
+            {
+                return count;
+            }
+
+            khz[count++] = rdsparser_af_get_frequency(i * RDSPARSER_AF_WORD_BITS + rdsparser_af_ctz(word));
+            word &= word - 1;
+        }
+    }
+
+    return count;
+}
+
+#ifndef RDSPARSER_DISABLE_AF
+void
+rdsparser_af_table_clear(rdsparser_af_table_t *table)
+{
+    for (uint8_t i = 0; i < RDSPARSER_AF_TABLE_SIZE; i++)
+    {
+        table->last_seen[i] = 0;
+        table->hits[i] = 0;
+    }
+}
+
+void
+rdsparser_af_table_hit(rdsparser_af_table_t *table,
+                       uint8_t               value,
+                       uint64_t              now)
+{
+    if (value >= RDSPARSER_AF_MIN &&
+        value <= RDSPARSER_AF_MAX)
+    {
+        table->last_seen[value] = now;
+        if (table->hits[value] != UINT16_MAX)
+        {
+            table->hits[value]++;
+        }
+    }
+}
+
+bool
+rdsparser_af_table_expired(const rdsparser_af_table_t *table,
+                           uint8_t                     value,
+                           uint64_t                    now,
+                           uint32_t                    max_age)
+{
+    return (now > table->last_seen[value] &&
+            now - table->last_seen[value] > max_age);
+}
+#endif
@@ -17,10 +17,19 @@
 #ifndef RDSPARSER_AF_H
 #define RDSPARSER_AF_H
 #include <stdint.h>
-#include <librdsparser.h>
+#include <librdsparser_private.h>
 
 bool rdsparser_af_set(rdsparser_af_t *af, uint8_t value);
 bool rdsparser_af_get(const rdsparser_af_t *af, uint8_t value);
+bool rdsparser_af_unset(rdsparser_af_t *af, uint8_t value);
 void rdsparser_af_clear(rdsparser_af_t *af);
+uint32_t rdsparser_af_get_frequency(uint8_t value);
+uint8_t rdsparser_af_get_value(uint32_t frequency);
+
+#ifndef RDSPARSER_DISABLE_AF
+void rdsparser_af_table_clear(rdsparser_af_table_t *table);
+void rdsparser_af_table_hit(rdsparser_af_table_t *table, uint8_t value, uint64_t now);
+bool rdsparser_af_table_expired(const rdsparser_af_table_t *table, uint8_t value, uint64_t now, uint32_t max_age);
+#endif
 
 #endif
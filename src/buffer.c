@@ -29,6 +29,14 @@
     buffer->data_used.name = value; \
     return true;
 
+#define RDSPARSER_BUFFER_RESET(buffer, name, value) \
+    buffer->data_temp.name = value; \
+    if (buffer->data_used.name == value) \
+    { \
+        return false; \
+    } \
+    buffer->data_used.name = value; \
+    return true;
 
 static void
 rdsparser_buffer_data_clear(rdsparser_buffer_data_t *data)
@@ -40,6 +48,12 @@ rdsparser_buffer_data_clear(rdsparser_buffer_data_t *data)
     data->ms = RDSPARSER_MS_UNKNOWN;
     data->ecc = RDSPARSER_ECC_UNKNOWN;
     data->country = RDSPARSER_COUNTRY_UNKNOWN;
+    data->pin = RDSPARSER_PIN_UNKNOWN;
+    data->la = RDSPARSER_LA_UNKNOWN;
+    for (uint8_t i = 0; i < RDSPARSER_SLC_VARIANT_COUNT; i++)
+    {
+        data->slc[i] = RDSPARSER_SLC_UNKNOWN;
+    }
     rdsparser_af_clear(&data->af);
 }
 
@@ -83,6 +97,12 @@ rdsparser_buffer_get_pi(const rdsparser_buffer_t *buffer)
     return buffer->data_used.pi;
 }
 
+bool
+rdsparser_buffer_reset_pi(rdsparser_buffer_t *buffer)
+{
+    RDSPARSER_BUFFER_RESET(buffer, pi, RDSPARSER_PI_UNKNOWN);
+}
+
 bool
 rdsparser_buffer_update_pty(rdsparser_buffer_t *buffer,
                             rdsparser_pty_t     value)
@@ -96,6 +116,12 @@ rdsparser_buffer_get_pty(const rdsparser_buffer_t *buffer)
     return buffer->data_used.pty;
 }
 
+bool
+rdsparser_buffer_reset_pty(rdsparser_buffer_t *buffer)
+{
+    RDSPARSER_BUFFER_RESET(buffer, pty, RDSPARSER_PTY_UNKNOWN);
+}
+
 bool
 rdsparser_buffer_update_tp(rdsparser_buffer_t *buffer,
                            rdsparser_tp_t      value)
@@ -109,6 +135,12 @@ rdsparser_buffer_get_tp(const rdsparser_buffer_t *buffer)
     return buffer->data_used.tp;
 }
 
+bool
+rdsparser_buffer_reset_tp(rdsparser_buffer_t *buffer)
+{
+    RDSPARSER_BUFFER_RESET(buffer, tp, RDSPARSER_TP_UNKNOWN);
+}
+
 bool
 rdsparser_buffer_update_ta(rdsparser_buffer_t *buffer,
                            rdsparser_ta_t      value)
@@ -122,6 +154,12 @@ rdsparser_buffer_get_ta(const rdsparser_buffer_t *buffer)
     return buffer->data_used.ta;
 }
 
+bool
+rdsparser_buffer_reset_ta(rdsparser_buffer_t *buffer)
+{
+    RDSPARSER_BUFFER_RESET(buffer, ta, RDSPARSER_TA_UNKNOWN);
+}
+
 bool
 rdsparser_buffer_update_ms(rdsparser_buffer_t *buffer,
                            rdsparser_ms_t      value)
@@ -135,6 +173,12 @@ rdsparser_buffer_get_ms(const rdsparser_buffer_t *buffer)
     return buffer->data_used.ms;
 }
 
+bool
+rdsparser_buffer_reset_ms(rdsparser_buffer_t *buffer)
+{
+    RDSPARSER_BUFFER_RESET(buffer, ms, RDSPARSER_MS_UNKNOWN);
+}
+
 bool
 rdsparser_buffer_update_ecc(rdsparser_buffer_t *buffer,
                             rdsparser_ecc_t     value)
@@ -148,6 +192,12 @@ rdsparser_buffer_get_ecc(const rdsparser_buffer_t *buffer)
     return buffer->data_used.ecc;
 }
 
+bool
+rdsparser_buffer_reset_ecc(rdsparser_buffer_t *buffer)
+{
+    RDSPARSER_BUFFER_RESET(buffer, ecc, RDSPARSER_ECC_UNKNOWN);
+}
+
 bool
 rdsparser_buffer_update_country(rdsparser_buffer_t  *buffer,
                                 rdsparser_country_t  value)
@@ -161,6 +211,59 @@ rdsparser_buffer_get_country(const rdsparser_buffer_t *buffer)
     return buffer->data_used.country;
 }
 
+bool
+rdsparser_buffer_reset_country(rdsparser_buffer_t *buffer)
+{
+    RDSPARSER_BUFFER_RESET(buffer, country, RDSPARSER_COUNTRY_UNKNOWN);
+}
+
+bool
+rdsparser_buffer_update_pin(rdsparser_buffer_t *buffer,
+                            rdsparser_pin_t     value)
+{
+    RDSPARSER_BUFFER_UPDATE(buffer, pin, value);
+}
+
+rdsparser_pin_t
+rdsparser_buffer_get_pin(const rdsparser_buffer_t *buffer)
+{
+    return buffer->data_used.pin;
+}
+
+bool
+rdsparser_buffer_reset_pin(rdsparser_buffer_t *buffer)
+{
+    RDSPARSER_BUFFER_RESET(buffer, pin, RDSPARSER_PIN_UNKNOWN);
+}
+
+bool
+rdsparser_buffer_update_la(rdsparser_buffer_t *buffer,
+                           rdsparser_la_t      value)
+{
+    RDSPARSER_BUFFER_UPDATE(buffer, la, value);
+}
+
+rdsparser_la_t
+rdsparser_buffer_get_la(const rdsparser_buffer_t *buffer)
+{
+    return buffer->data_used.la;
+}
+
+bool
+rdsparser_buffer_update_slc(rdsparser_buffer_t      *buffer,
+                            rdsparser_slc_variant_t  variant,
+                            rdsparser_slc_t          value)
+{
+    RDSPARSER_BUFFER_UPDATE(buffer, slc[variant], value);
+}
+
+rdsparser_slc_t
+rdsparser_buffer_get_slc(const rdsparser_buffer_t *buffer,
+                         rdsparser_slc_variant_t   variant)
+{
+    return buffer->data_used.slc[variant];
+}
+
 bool
 rdsparser_buffer_add_af(rdsparser_buffer_t *buffer,
                         uint8_t             value)
@@ -180,6 +283,22 @@ rdsparser_buffer_add_af(rdsparser_buffer_t *buffer,
     return false;
 }
 
+bool
+rdsparser_buffer_remove_af(rdsparser_buffer_t *buffer,
+                           uint8_t             value)
+{
+    rdsparser_af_unset(&buffer->data_temp.af, value);
+    return rdsparser_af_unset(&buffer->data_used.af, value);
+}
+
+void
+rdsparser_buffer_set_af(rdsparser_buffer_t   *buffer,
+                        const rdsparser_af_t *af)
+{
+    buffer->data_used.af = *af;
+    buffer->data_temp.af = *af;
+}
+
 const rdsparser_af_t*
 rdsparser_buffer_get_af(const rdsparser_buffer_t *buffer)
 {
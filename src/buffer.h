@@ -26,26 +26,45 @@ bool rdsparser_buffer_get_extended_check(const rdsparser_buffer_t *buffer);
 
 bool rdsparser_buffer_update_pi(rdsparser_buffer_t *buffer, rdsparser_pi_t value);
 rdsparser_pi_t rdsparser_buffer_get_pi(const rdsparser_buffer_t *buffer);
+bool rdsparser_buffer_reset_pi(rdsparser_buffer_t *buffer);
 
 bool rdsparser_buffer_update_pty(rdsparser_buffer_t *buffer, rdsparser_pty_t value);
 rdsparser_pty_t rdsparser_buffer_get_pty(const rdsparser_buffer_t *buffer);
+bool rdsparser_buffer_reset_pty(rdsparser_buffer_t *buffer);
 
 bool rdsparser_buffer_update_tp(rdsparser_buffer_t *buffer, rdsparser_tp_t value);
 rdsparser_tp_t rdsparser_buffer_get_tp(const rdsparser_buffer_t *buffer);
+bool rdsparser_buffer_reset_tp(rdsparser_buffer_t *buffer);
 
 bool rdsparser_buffer_update_ta(rdsparser_buffer_t *buffer, rdsparser_ta_t value);
 rdsparser_ta_t rdsparser_buffer_get_ta(const rdsparser_buffer_t *buffer);
+bool rdsparser_buffer_reset_ta(rdsparser_buffer_t *buffer);
 
 bool rdsparser_buffer_update_ms(rdsparser_buffer_t *buffer, rdsparser_ms_t value);
 rdsparser_ms_t rdsparser_buffer_get_ms(const rdsparser_buffer_t *buffer);
+bool rdsparser_buffer_reset_ms(rdsparser_buffer_t *buffer);
 
 bool rdsparser_buffer_update_ecc(rdsparser_buffer_t *buffer, rdsparser_ecc_t value);
 rdsparser_ecc_t rdsparser_buffer_get_ecc(const rdsparser_buffer_t *buffer);
+bool rdsparser_buffer_reset_ecc(rdsparser_buffer_t *buffer);
 
 bool rdsparser_buffer_update_country(rdsparser_buffer_t *buffer, rdsparser_country_t value);
 rdsparser_country_t rdsparser_buffer_get_country(const rdsparser_buffer_t *buffer);
+bool rdsparser_buffer_reset_country(rdsparser_buffer_t *buffer);
+
+bool rdsparser_buffer_update_pin(rdsparser_buffer_t *buffer, rdsparser_pin_t value);
+rdsparser_pin_t rdsparser_buffer_get_pin(const rdsparser_buffer_t *buffer);
+bool rdsparser_buffer_reset_pin(rdsparser_buffer_t *buffer);
+
+bool rdsparser_buffer_update_la(rdsparser_buffer_t *buffer, rdsparser_la_t value);
+rdsparser_la_t rdsparser_buffer_get_la(const rdsparser_buffer_t *buffer);
+
+bool rdsparser_buffer_update_slc(rdsparser_buffer_t *buffer, rdsparser_slc_variant_t variant, rdsparser_slc_t value);
+rdsparser_slc_t rdsparser_buffer_get_slc(const rdsparser_buffer_t *buffer, rdsparser_slc_variant_t variant);
 
 bool rdsparser_buffer_add_af(rdsparser_buffer_t *buffer, uint8_t value);
+bool rdsparser_buffer_remove_af(rdsparser_buffer_t *buffer, uint8_t value);
+void rdsparser_buffer_set_af(rdsparser_buffer_t *buffer, const rdsparser_af_t *af);
 const rdsparser_af_t* rdsparser_buffer_get_af(const rdsparser_buffer_t *buffer);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <librdsparser.h>
+#include "charset.h"
+
+#define INV    ((uint16_t)(RDSPARSER_CHARSET_CLASS_INVALID << 14))
+#define EOL    ((uint16_t)(RDSPARSER_CHARSET_CLASS_EOL << 14))
+#define B(x)   ((uint16_t)((RDSPARSER_CHARSET_CLASS_BASIC << 14) | (x)))
+#define S(x)   ((uint16_t)((RDSPARSER_CHARSET_CLASS_SPECIAL << 14) | (x)))
+
+static const uint16_t rdsparser_charset_table[RDSPARSER_CHARSET_COUNT][256] =
+{
+    {
+        /* G0 */
+        INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, EOL, INV, INV,
+        INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV,
+        B(L' '), B(L'!'), B(L'"'), B(L'#'), B(L'¤'), B(L'%'), B(L'&'), B(L'\''), B(L'('), B(L')'), B(L'*'), B(L'+'), B(L','), B(L'-'), B(L'.'), B(L'/'),
+        B(L'0'), B(L'1'), B(L'2'), B(L'3'), B(L'4'), B(L'5'), B(L'6'), B(L'7'), B(L'8'), B(L'9'), B(L':'), B(L';'), B(L'<'), B(L'='), B(L'>'), B(L'?'),
+        B(L'@'), B(L'A'), B(L'B'), B(L'C'), B(L'D'), B(L'E'), B(L'F'), B(L'G'), B(L'H'), B(L'I'), B(L'J'), B(L'K'), B(L'L'), B(L'M'), B(L'N'), B(L'O'),
+        B(L'P'), B(L'Q'), B(L'R'), B(L'S'), B(L'T'), B(L'U'), B(L'V'), B(L'W'), B(L'X'), B(L'Y'), B(L'Z'), B(L'['), B(L'\\'), B(L']'), B(L'―'), B(L'_'),
+        B(L'‖'), B(L'a'), B(L'b'), B(L'c'), B(L'd'), B(L'e'), B(L'f'), B(L'g'), B(L'h'), B(L'i'), B(L'j'), B(L'k'), B(L'l'), B(L'm'), B(L'n'), B(L'o'),
+        B(L'p'), B(L'q'), B(L'r'), B(L's'), B(L't'), B(L'u'), B(L'v'), B(L'w'), B(L'x'), B(L'y'), B(L'z'), B(L'{'), B(L'|'), B(L'}'), B(L'¯'), S(L' '),
+        S(L'á'), S(L'à'), S(L'é'), S(L'è'), S(L'í'), S(L'ì'), S(L'ó'), S(L'ò'), S(L'ú'), S(L'ù'), S(L'Ñ'), S(L'Ç'), S(L'Ş'), S(L'β'), S(L'¡'), S(L'Ĳ'),
+        S(L'â'), S(L'ä'), S(L'ê'), S(L'ë'), S(L'î'), S(L'ï'), S(L'ô'), S(L'ö'), S(L'û'), S(L'ü'), S(L'ñ'), S(L'ç'), S(L'ş'), S(L'ǧ'), S(L'ı'), S(L'ĳ'),
+        S(L'ª'), S(L'α'), S(L'©'), S(L'‰'), S(L'Ǧ'), S(L'ě'), S(L'ň'), S(L'ő'), S(L'π'), S(L'€'), S(L'£'), S(L'$'), S(L'←'), S(L'↑'), S(L'→'), S(L'↓'),
+        S(L'º'), S(L'¹'), S(L'²'), S(L'³'), S(L'±'), S(L'İ'), S(L'ń'), S(L'ű'), S(L'µ'), S(L'¿'), S(L'÷'), S(L'°'), S(L'¼'), S(L'½'), S(L'¾'), S(L'§'),
+        S(L'Á'), S(L'À'), S(L'É'), S(L'È'), S(L'Í'), S(L'Ì'), S(L'Ó'), S(L'Ò'), S(L'Ú'), S(L'Ù'), S(L'Ř'), S(L'Č'), S(L'Š'), S(L'Ž'), S(L'Ð'), S(L'Ŀ'),
+        S(L'Â'), S(L'Ä'), S(L'Ê'), S(L'Ë'), S(L'Î'), S(L'Ï'), S(L'Ô'), S(L'Ö'), S(L'Û'), S(L'Ü'), S(L'ř'), S(L'č'), S(L'š'), S(L'ž'), S(L'đ'), S(L'ŀ'),
+        S(L'Ã'), S(L'Å'), S(L'Æ'), S(L'Œ'), S(L'ŷ'), S(L'Ý'), S(L'Õ'), S(L'Ø'), S(L'Þ'), S(L'Ŋ'), S(L'Ŕ'), S(L'Ć'), S(L'Ś'), S(L'Ź'), S(L'Ŧ'), S(L'ð'),
+        S(L'ã'), S(L'å'), S(L'æ'), S(L'œ'), S(L'ŵ'), S(L'ý'), S(L'õ'), S(L'ø'), S(L'þ'), S(L'ŋ'), S(L'ŕ'), S(L'ć'), S(L'ś'), S(L'ź'), S(L'ŧ'), S(L' ')
+    },
+    {
+        /* Raw bytes (UTF-8) */
+        INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, EOL, INV, INV,
+        INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV, INV,
+        B(0x20), B(0x21), B(0x22), B(0x23), B(0x24), B(0x25), B(0x26), B(0x27), B(0x28), B(0x29), B(0x2A), B(0x2B), B(0x2C), B(0x2D), B(0x2E), B(0x2F),
+        B(0x30), B(0x31), B(0x32), B(0x33), B(0x34), B(0x35), B(0x36), B(0x37), B(0x38), B(0x39), B(0x3A), B(0x3B), B(0x3C), B(0x3D), B(0x3E), B(0x3F),
+        B(0x40), B(0x41), B(0x42), B(0x43), B(0x44), B(0x45), B(0x46), B(0x47), B(0x48), B(0x49), B(0x4A), B(0x4B), B(0x4C), B(0x4D), B(0x4E), B(0x4F),
+        B(0x50), B(0x51), B(0x52), B(0x53), B(0x54), B(0x55), B(0x56), B(0x57), B(0x58), B(0x59), B(0x5A), B(0x5B), B(0x5C), B(0x5D), B(0x5E), B(0x5F),
+        B(0x60), B(0x61), B(0x62), B(0x63), B(0x64), B(0x65), B(0x66), B(0x67), B(0x68), B(0x69), B(0x6A), B(0x6B), B(0x6C), B(0x6D), B(0x6E), B(0x6F),
+        B(0x70), B(0x71), B(0x72), B(0x73), B(0x74), B(0x75), B(0x76), B(0x77), B(0x78), B(0x79), B(0x7A), B(0x7B), B(0x7C), B(0x7D), B(0x7E), S(0x7F),
+        S(0x80), S(0x81), S(0x82), S(0x83), S(0x84), S(0x85), S(0x86), S(0x87), S(0x88), S(0x89), S(0x8A), S(0x8B), S(0x8C), S(0x8D), S(0x8E), S(0x8F),
+        S(0x90), S(0x91), S(0x92), S(0x93), S(0x94), S(0x95), S(0x96), S(0x97), S(0x98), S(0x99), S(0x9A), S(0x9B), S(0x9C), S(0x9D), S(0x9E), S(0x9F),
+        S(0xA0), S(0xA1), S(0xA2), S(0xA3), S(0xA4), S(0xA5), S(0xA6), S(0xA7), S(0xA8), S(0xA9), S(0xAA), S(0xAB), S(0xAC), S(0xAD), S(0xAE), S(0xAF),
+        S(0xB0), S(0xB1), S(0xB2), S(0xB3), S(0xB4), S(0xB5), S(0xB6), S(0xB7), S(0xB8), S(0xB9), S(0xBA), S(0xBB), S(0xBC), S(0xBD), S(0xBE), S(0xBF),
+        S(0xC0), S(0xC1), S(0xC2), S(0xC3), S(0xC4), S(0xC5), S(0xC6), S(0xC7), S(0xC8), S(0xC9), S(0xCA), S(0xCB), S(0xCC), S(0xCD), S(0xCE), S(0xCF),
+        S(0xD0), S(0xD1), S(0xD2), S(0xD3), S(0xD4), S(0xD5), S(0xD6), S(0xD7), S(0xD8), S(0xD9), S(0xDA), S(0xDB), S(0xDC), S(0xDD), S(0xDE), S(0xDF),
+        S(0xE0), S(0xE1), S(0xE2), S(0xE3), S(0xE4), S(0xE5), S(0xE6), S(0xE7), S(0xE8), S(0xE9), S(0xEA), S(0xEB), S(0xEC), S(0xED), S(0xEE), S(0xEF),
+        S(0xF0), S(0xF1), S(0xF2), S(0xF3), S(0xF4), S(0xF5), S(0xF6), S(0xF7), S(0xF8), S(0xF9), S(0xFA), S(0xFB), S(0xFC), S(0xFD), S(0xFE), S(0xFF)
+    }
+};
+
+#undef INV
+#undef EOL
+#undef B
+#undef S
+
+uint16_t
+rdsparser_charset_lookup(uint8_t charset,
+                         uint8_t input)
+{
+    return rdsparser_charset_table[charset][input];
+}
+
+bool
+rdsparser_charset_is_switch(const char input[2])
+{
+    const uint8_t first = (uint8_t)input[0];
+    const uint8_t second = (uint8_t)input[1];
+
+    /* SO (G1), LS2 (G2) or back to G0 */
+    return ((first == 0x0E && second == 0x0E) ||
+            (first == 0x1B && second == 0x6E) ||
+            (first == 0x0F && second == 0x0F));
+}
@@ -0,0 +1,43 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_CHARSET_H
+#define RDSPARSER_CHARSET_H
+#include <librdsparser.h>
+
+/* Each table entry packs a character class (bits 15-14)
+   and a Unicode code point (bits 13-0) */
+#define RDSPARSER_CHARSET_CLASS(entry) ((uint8_t)((entry) >> 14))
+#define RDSPARSER_CHARSET_CODE(entry)  ((uint16_t)((entry) & 0x3FFF))
+
+typedef uint8_t rdsparser_charset_class_t;
+enum rdsparser_charset_class
+{
+    RDSPARSER_CHARSET_CLASS_INVALID = 0,
+    RDSPARSER_CHARSET_CLASS_BASIC = 1,
+    RDSPARSER_CHARSET_CLASS_SPECIAL = 2,
+    RDSPARSER_CHARSET_CLASS_EOL = 3
+};
+
+/* G0 code table and raw bytes for UTF-8 strings */
+#define RDSPARSER_CHARSET_G0 0
+#define RDSPARSER_CHARSET_RAW 1
+#define RDSPARSER_CHARSET_COUNT 2
+
+uint16_t rdsparser_charset_lookup(uint8_t charset, uint8_t input);
+bool rdsparser_charset_is_switch(const char input[2]);
+
+#endif
@@ -18,6 +18,13 @@
 #include <stdbool.h>
 #include "ct.h"
 
+/* Unix epoch as MJD */
+#define RDSPARSER_CT_MJD_EPOCH 40587
+
+/* Group duration: 104 bits at 1187.5 bps */
+#define RDSPARSER_CT_GROUP_NUMERATOR   208
+#define RDSPARSER_CT_GROUP_DENOMINATOR 2375
+
 bool
 rdsparser_ct_init(rdsparser_ct_t *ct,
                   uint32_t        mjd,
@@ -32,75 +39,112 @@ rdsparser_ct_init(rdsparser_ct_t *ct,
         return false;
     }
 
-    minute += (offset % 2) * 30;
-    if (minute >= 60)
-    {
-        hour++;
-        minute %= 60;
-    }
-    else if (minute < 0)
-    {
-        hour--;
-        minute = 60 + minute;
-    }
+    /* Keep the UTC time, local fields are calculated on demand */
+    ct->mjd = mjd;
+    ct->hour = hour;
+    ct->minute = minute;
+    ct->offset = offset;
 
-    hour += (offset / 2);
-    if (hour >= 24)
+    return true;
+}
+
+static void
+rdsparser_ct_get_local(const rdsparser_ct_t *ct,
+                       uint32_t             *mjd,
+                       uint8_t              *hour,
+                       uint8_t              *minute)
+{
+    const int16_t minutes_per_day = 24 * 60;
+    int16_t local = ct->hour * 60 + ct->minute + ct->offset * 30;
+
+    *mjd = ct->mjd;
+    if (local >= minutes_per_day)
     {
-        mjd++;
-        hour %= 24;
+        (*mjd)++;
+        local -= minutes_per_day;
     }
-    else if (hour < 0)
+    else if (local < 0)
     {
-        mjd--;
-        hour = 24 + hour;
+        (*mjd)--;
+        local += minutes_per_day;
     }
 
-    ct->year = ((mjd * 100 - 1507820) / 36525);
-    uint32_t year_tmp = (ct->year * 36525) / 100;
-    ct->month = ((mjd * 100 - 1495610) - year_tmp * 100) * 100 / 306001;
-    uint32_t month_tmp = (ct->month * 306001) / 10000;
-    ct->day = mjd - 14956 - year_tmp - month_tmp;
+    *hour = (uint8_t)(local / 60);
+    *minute = (uint8_t)(local % 60);
+}
 
-    uint8_t k = (ct->month == 14 || ct->month == 15) ? 1 : 0;
-    ct->year = 1900 + ct->year + k;
-    ct->month = ct->month - 1 - k * 12;
-    
-    ct->hour = hour;
-    ct->minute = minute;
-    ct->offset = offset;
-    
-    return true;
+void
+rdsparser_ct_get_date(const rdsparser_ct_t *ct,
+                      uint16_t             *year,
+                      uint8_t              *month,
+                      uint8_t              *day)
+{
+    /* All three fields come from a single MJD conversion,
+       use this instead of the separate getters for a full date */
+    uint32_t mjd;
+    uint8_t hour;
+    uint8_t minute;
+    rdsparser_ct_get_local(ct, &mjd, &hour, &minute);
+
+    uint32_t y = ((mjd * 100 - 1507820) / 36525);
+    uint32_t year_tmp = (y * 36525) / 100;
+    uint32_t m = ((mjd * 100 - 1495610) - year_tmp * 100) * 100 / 306001;
+    uint32_t month_tmp = (m * 306001) / 10000;
+    *day = (uint8_t)(mjd - 14956 - year_tmp - month_tmp);
+
+    uint8_t k = (m == 14 || m == 15) ? 1 : 0;
+    *year = (uint16_t)(1900 + y + k);
+    *month = (uint8_t)(m - 1 - k * 12);
 }
 
 uint16_t
 rdsparser_ct_get_year(const rdsparser_ct_t *ct)
 {
-    return ct->year;
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    rdsparser_ct_get_date(ct, &year, &month, &day);
+    return year;
 }
 
 uint8_t
 rdsparser_ct_get_month(const rdsparser_ct_t *ct)
 {
-    return ct->month;
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    rdsparser_ct_get_date(ct, &year, &month, &day);
+    return month;
 }
 
 uint8_t
 rdsparser_ct_get_day(const rdsparser_ct_t *ct)
 {
-    return ct->day;
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    rdsparser_ct_get_date(ct, &year, &month, &day);
+    return day;
 }
 
 uint8_t
 rdsparser_ct_get_hour(const rdsparser_ct_t *ct)
 {
-    return ct->hour;
+    uint32_t mjd;
+    uint8_t hour;
+    uint8_t minute;
+    rdsparser_ct_get_local(ct, &mjd, &hour, &minute);
+    return hour;
 }
 
 uint8_t
 rdsparser_ct_get_minute(const rdsparser_ct_t *ct)
 {
-    return ct->minute;
+    uint32_t mjd;
+    uint8_t hour;
+    uint8_t minute;
+    rdsparser_ct_get_local(ct, &mjd, &hour, &minute);
+    return minute;
 }
 
 int16_t
@@ -108,3 +152,45 @@ rdsparser_ct_get_offset(const rdsparser_ct_t *ct)
 {
     return (int16_t)ct->offset * 30;
 }
+
+int64_t
+rdsparser_ct_get_epoch(const rdsparser_ct_t *ct)
+{
+    return ((int64_t)ct->mjd - RDSPARSER_CT_MJD_EPOCH) * 86400 +
+           ct->hour * 3600 +
+           ct->minute * 60;
+}
+
+void
+rdsparser_ct_filter_clear(rdsparser_ct_filter_t *filter)
+{
+    filter->valid = false;
+}
+
+bool
+rdsparser_ct_filter_check(rdsparser_ct_filter_t *filter,
+                          const rdsparser_ct_t  *ct,
+                          uint32_t               groups)
+{
+    const int64_t epoch = rdsparser_ct_get_epoch(ct);
+    bool plausible = false;
+
+    if (filter->valid)
+    {
+        const uint32_t elapsed = groups - filter->groups;
+        const int64_t expected = filter->epoch +
+                                 (int64_t)elapsed * RDSPARSER_CT_GROUP_NUMERATOR / RDSPARSER_CT_GROUP_DENOMINATOR;
+        const int64_t difference = epoch - expected;
+
+        plausible = (difference >= -RDSPARSER_CT_FILTER_WINDOW &&
+                     difference <= RDSPARSER_CT_FILTER_WINDOW);
+    }
+
+    /* The rejected time becomes a new candidate,
+       so a real time jump is accepted on the next CT */
+    filter->valid = true;
+    filter->epoch = epoch;
+    filter->groups = groups;
+
+    return plausible;
+}
@@ -16,18 +16,22 @@
 
 #ifndef RDSPARSER_CT_H
 #define RDSPARSER_CT_H
-#include <librdsparser.h>
+#include <librdsparser_private.h>
+
+/* Maximum difference (in seconds) between the received time
+   and the time extrapolated from the previous one */
+#define RDSPARSER_CT_FILTER_WINDOW 90
 
 typedef struct rdsparser_ct
 {
-    uint16_t year;
-    uint8_t month;
-    uint8_t day;
+    uint32_t mjd;
     uint8_t hour;
     uint8_t minute;
     int8_t offset;
 } rdsparser_ct_t;
 
 bool rdsparser_ct_init(rdsparser_ct_t *ct, uint32_t mjd, int8_t hour, int8_t minute, int8_t offset);
+void rdsparser_ct_filter_clear(rdsparser_ct_filter_t *filter);
+bool rdsparser_ct_filter_check(rdsparser_ct_filter_t *filter, const rdsparser_ct_t *ct, uint32_t groups);
 
 #endif
@@ -0,0 +1,266 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <librdsparser_private.h>
+#include "eon.h"
+#include "af.h"
+#include "string.h"
+
+static inline uint8_t
+rdsparser_eon_table_hash(uint16_t pi)
+{
+    /* Country and area code in the upper byte,
+       programme reference in the lower byte */
+    return (uint8_t)(pi ^ (pi >> 8)) & (RDSPARSER_EON_TABLE_SIZE - 1);
+}
+
+static void
+rdsparser_eon_clear(rdsparser_eon_t *eon)
+{
+    eon->pi = RDSPARSER_PI_UNKNOWN;
+    eon->pty = RDSPARSER_PTY_UNKNOWN;
+    eon->tp = RDSPARSER_TP_UNKNOWN;
+    eon->ta = RDSPARSER_TA_UNKNOWN;
+    rdsparser_af_clear(&eon->af);
+    for (uint8_t i = 0; i < RDSPARSER_EON_MAPPING_SIZE; i++)
+    {
+        eon->mapping[i][0] = 0;
+        eon->mapping[i][1] = 0;
+    }
+    rdsparser_string_clear(eon->ps);
+}
+
+void
+rdsparser_eon_table_init(rdsparser_eon_table_t *table)
+{
+    for (uint8_t i = 0; i < RDSPARSER_EON_TABLE_SIZE; i++)
+    {
+        rdsparser_string_init(table->entry[i].ps, RDSPARSER_PS_LENGTH, RDSPARSER_STRING_ENCODING_BASIC);
+    }
+
+    rdsparser_eon_table_clear(table);
+}
+
+void
+rdsparser_eon_table_clear(rdsparser_eon_table_t *table)
+{
+    for (uint8_t i = 0; i < RDSPARSER_EON_TABLE_SIZE; i++)
+    {
+        rdsparser_eon_clear(&table->entry[i]);
+        table->order[i] = 0;
+    }
+
+    table->count = 0;
+}
+
+rdsparser_eon_t*
+rdsparser_eon_table_lookup(rdsparser_eon_table_t *table,
+                           uint16_t               pi)
+{
+    uint8_t index = rdsparser_eon_table_hash(pi);
+
+    for (uint8_t i = 0; i < RDSPARSER_EON_TABLE_SIZE; i++)
+    {
+        rdsparser_eon_t *eon = &table->entry[index];
+        if (eon->pi == pi)
+        {
+            return eon;
+        }
+
+        if (eon->pi == RDSPARSER_PI_UNKNOWN)
+        {
+            /* Entries are never removed, so the probe ends here */
+            return NULL;
+        }
+
+        index = (index + 1) & (RDSPARSER_EON_TABLE_SIZE - 1);
+    }
+
+    return NULL;
+}
+
+rdsparser_eon_t*
+rdsparser_eon_table_insert(rdsparser_eon_table_t *table,
+                           uint16_t               pi)
+{
+    uint8_t index = rdsparser_eon_table_hash(pi);
+
+    for (uint8_t i = 0; i < RDSPARSER_EON_TABLE_SIZE; i++)
+    {
+        rdsparser_eon_t *eon = &table->entry[index];
+        if (eon->pi == pi)
+        {
+            return eon;
+        }
+
+        if (eon->pi == RDSPARSER_PI_UNKNOWN)
+        {
+            eon->pi = pi;
+            table->order[table->count++] = index;
+            return eon;
+        }
+
+        index = (index + 1) & (RDSPARSER_EON_TABLE_SIZE - 1);
+    }
+
+    /* Table is full */
+    return NULL;
+}
+
+bool
+rdsparser_eon_update_pty(rdsparser_eon_t *eon,
+                         rdsparser_pty_t  pty)
+{
+    if (eon->pty == pty)
+    {
+        return false;
+    }
+
+    eon->pty = pty;
+    return true;
+}
+
+bool
+rdsparser_eon_update_tp(rdsparser_eon_t *eon,
+                        rdsparser_tp_t   tp)
+{
+    if (eon->tp == tp)
+    {
+        return false;
+    }
+
+    eon->tp = tp;
+    return true;
+}
+
+bool
+rdsparser_eon_update_ta(rdsparser_eon_t *eon,
+                        rdsparser_ta_t   ta)
+{
+    if (eon->ta == ta)
+    {
+        return false;
+    }
+
+    eon->ta = ta;
+    return true;
+}
+
+bool
+rdsparser_eon_add_af(rdsparser_eon_t *eon,
+                     uint8_t          value)
+{
+    if (rdsparser_af_get(&eon->af, value))
+    {
+        return false;
+    }
+
+    return rdsparser_af_set(&eon->af, value);
+}
+
+bool
+rdsparser_eon_add_mapping(rdsparser_eon_t *eon,
+                          uint8_t          tuned,
+                          uint8_t          mapped)
+{
+    if (tuned < 1 || tuned > 204 ||
+        mapped < 1 || mapped > 204)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < RDSPARSER_EON_MAPPING_SIZE; i++)
+    {
+        if (eon->mapping[i][0] == tuned ||
+            eon->mapping[i][0] == 0)
+        {
+            if (eon->mapping[i][0] == tuned &&
+                eon->mapping[i][1] == mapped)
+            {
+                return false;
+            }
+
+            eon->mapping[i][0] = tuned;
+            eon->mapping[i][1] = mapped;
+            return true;
+        }
+    }
+
+    /* No free slot, replace the oldest mapping */
+    for (uint8_t i = 1; i < RDSPARSER_EON_MAPPING_SIZE; i++)
+    {
+        eon->mapping[i - 1][0] = eon->mapping[i][0];
+        eon->mapping[i - 1][1] = eon->mapping[i][1];
+    }
+
+    eon->mapping[RDSPARSER_EON_MAPPING_SIZE - 1][0] = tuned;
+    eon->mapping[RDSPARSER_EON_MAPPING_SIZE - 1][1] = mapped;
+    return true;
+}
+
+rdsparser_pi_t
+rdsparser_eon_get_pi(const rdsparser_eon_t *eon)
+{
+    return eon->pi;
+}
+
+rdsparser_pty_t
+rdsparser_eon_get_pty(const rdsparser_eon_t *eon)
+{
+    return eon->pty;
+}
+
+rdsparser_tp_t
+rdsparser_eon_get_tp(const rdsparser_eon_t *eon)
+{
+    return eon->tp;
+}
+
+rdsparser_ta_t
+rdsparser_eon_get_ta(const rdsparser_eon_t *eon)
+{
+    return eon->ta;
+}
+
+const rdsparser_af_t*
+rdsparser_eon_get_af(const rdsparser_eon_t *eon)
+{
+    return &eon->af;
+}
+
+const rdsparser_string_t*
+rdsparser_eon_get_ps(const rdsparser_eon_t *eon)
+{
+    return eon->ps;
+}
+
+uint32_t
+rdsparser_eon_get_mapped(const rdsparser_eon_t *eon,
+                         uint32_t               frequency)
+{
+    const uint8_t tuned = rdsparser_af_get_value(frequency);
+
+    for (uint8_t i = 0; tuned && i < RDSPARSER_EON_MAPPING_SIZE; i++)
+    {
+        if (eon->mapping[i][0] == tuned)
+        {
+            return rdsparser_af_get_frequency(eon->mapping[i][1]);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_EON_H
+#define RDSPARSER_EON_H
+#include <librdsparser_private.h>
+
+void rdsparser_eon_table_init(rdsparser_eon_table_t *table);
+void rdsparser_eon_table_clear(rdsparser_eon_table_t *table);
+rdsparser_eon_t* rdsparser_eon_table_lookup(rdsparser_eon_table_t *table, uint16_t pi);
+rdsparser_eon_t* rdsparser_eon_table_insert(rdsparser_eon_table_t *table, uint16_t pi);
+
+bool rdsparser_eon_update_pty(rdsparser_eon_t *eon, rdsparser_pty_t pty);
+bool rdsparser_eon_update_tp(rdsparser_eon_t *eon, rdsparser_tp_t tp);
+bool rdsparser_eon_update_ta(rdsparser_eon_t *eon, rdsparser_ta_t ta);
+bool rdsparser_eon_add_af(rdsparser_eon_t *eon, uint8_t value);
+bool rdsparser_eon_add_mapping(rdsparser_eon_t *eon, uint8_t tuned, uint8_t mapped);
+
+#endif
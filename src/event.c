@@ -0,0 +1,472 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <librdsparser_private.h>
+#include "event.h"
+
+/*
+ * Single producer (parser), single consumer ring:
+ * only the parser writes the head and only the consumer writes the tail,
+ * the acquire/release pairs publish the event contents between the threads.
+ * The overflow counter is written by the parser only.
+ */
+
+#define RDSPARSER_EVENT_RANGE_NONE 0xFF
+
+#if defined(__GNUC__)
+#define rdsparser_event_load(x) __atomic_load_n(x, __ATOMIC_ACQUIRE)
+#define rdsparser_event_store(x, value) __atomic_store_n(x, value, __ATOMIC_RELEASE)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+static inline uint32_t
+rdsparser_event_load(const uint32_t *x)
+{
+    const uint32_t value = *(const volatile uint32_t*)x;
+    atomic_thread_fence(memory_order_acquire);
+    return value;
+}
+
+static inline void
+rdsparser_event_store(uint32_t *x,
+                      uint32_t  value)
+{
+    atomic_thread_fence(memory_order_release);
+    *(volatile uint32_t*)x = value;
+}
+#else
+#error "The event queue requires GNU atomic builtins or C11 <stdatomic.h>"
+#endif
+
+void
+rdsparser_event_clear_range(rdsparser_event_queue_t *queue)
+{
+    for (uint8_t i = 0; i < RDSPARSER_TEXT_COUNT; i++)
+    {
+        queue->range[i][0] = RDSPARSER_EVENT_RANGE_NONE;
+        queue->range[i][1] = 0;
+    }
+}
+
+void
+rdsparser_event_range(rdsparser_event_queue_t *queue,
+                      rdsparser_text_t         text,
+                      uint8_t                  position)
+{
+    /* Strings are updated two characters at a time */
+    const uint8_t end = position + 2;
+
+    if (position < queue->range[text][0])
+    {
+        queue->range[text][0] = position;
+    }
+
+    if (end > queue->range[text][1])
+    {
+        queue->range[text][1] = end;
+    }
+}
+
+bool
+rdsparser_event_push(rdsparser_event_queue_t *queue,
+                     const rdsparser_event_t *event)
+{
+    const uint32_t head = queue->head;
+    const uint32_t tail = rdsparser_event_load(&queue->tail);
+
+    if (head - tail >= RDSPARSER_EVENT_QUEUE_SIZE)
+    {
+        /* Never wait for the consumer */
+        rdsparser_event_store(&queue->overflow, queue->overflow + 1);
+        return false;
+    }
+
+    queue->event[head % RDSPARSER_EVENT_QUEUE_SIZE] = *event;
+    rdsparser_event_store(&queue->head, head + 1);
+    return true;
+}
+
+static void
+rdsparser_event_emit(rdsparser_t            *rds,
+                     rdsparser_event_type_t  type,
+                     uint8_t                 index,
+                     int64_t                 value)
+{
+    const rdsparser_event_t event = { .type = type, .index = index, .value = value };
+    rdsparser_event_push(&rds->events, &event);
+}
+
+static void
+rdsparser_event_emit_string(rdsparser_t              *rds,
+                            rdsparser_event_type_t    type,
+                            rdsparser_text_t          text,
+                            uint8_t                   index,
+                            const rdsparser_string_t *string,
+                            uint8_t                   length)
+{
+    const rdsparser_string_char_t *content = rdsparser_string_get_content(string);
+    uint8_t *range = rds->events.range[text];
+    uint8_t start = 0;
+    uint8_t end = length;
+
+    if (range[0] != RDSPARSER_EVENT_RANGE_NONE)
+    {
+        start = range[0];
+        end = (range[1] < length ? range[1] : length);
+    }
+
+    range[0] = RDSPARSER_EVENT_RANGE_NONE;
+    range[1] = 0;
+
+    /* Longer ranges are split into consecutive events */
+    do
+    {
+        rdsparser_event_t event = { .type = type, .index = index, .start = start };
+
+        while (start < end &&
+               event.length < RDSPARSER_EVENT_TEXT_LENGTH)
+        {
+            event.text[event.length++] = content[start++];
+        }
+
+        rdsparser_event_push(&rds->events, &event);
+    }
+    while (start < end);
+}
+
+static void
+rdsparser_event_pi(rdsparser_t *rds,
+                   void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_PI, 0, rdsparser_get_pi(rds));
+}
+
+static void
+rdsparser_event_pty(rdsparser_t *rds,
+                    void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_PTY, 0, rdsparser_get_pty(rds));
+}
+
+static void
+rdsparser_event_tp(rdsparser_t *rds,
+                   void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_TP, 0, rdsparser_get_tp(rds));
+}
+
+static void
+rdsparser_event_ta(rdsparser_t *rds,
+                   void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_TA, 0, rdsparser_get_ta(rds));
+}
+
+static void
+rdsparser_event_ms(rdsparser_t *rds,
+                   void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_MS, 0, rdsparser_get_ms(rds));
+}
+
+static void
+rdsparser_event_ecc(rdsparser_t *rds,
+                    void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_ECC, 0, rdsparser_get_ecc(rds));
+}
+
+static void
+rdsparser_event_country(rdsparser_t *rds,
+                        void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_COUNTRY, 0, rdsparser_get_country(rds));
+}
+
+static void
+rdsparser_event_pin(rdsparser_t *rds,
+                    void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_PIN, 0, rdsparser_get_pin(rds));
+}
+
+static void
+rdsparser_event_la(rdsparser_t *rds,
+                   void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_LA, 0, rdsparser_get_la(rds));
+}
+
+static void
+rdsparser_event_slc(rdsparser_t             *rds,
+                    rdsparser_slc_variant_t  variant,
+                    void                    *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_SLC, variant, rdsparser_get_slc(rds, variant));
+}
+
+static void
+rdsparser_event_af(rdsparser_t *rds,
+                   uint32_t     frequency,
+                   void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_AF, 0, frequency);
+}
+
+static void
+rdsparser_event_af_expire(rdsparser_t *rds,
+                          uint32_t     frequency,
+                          void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_AF_EXPIRE, 0, frequency);
+}
+
+static void
+rdsparser_event_ps(rdsparser_t *rds,
+                   void        *user_data)
+{
+    rdsparser_event_emit_string(rds, RDSPARSER_EVENT_PS, RDSPARSER_TEXT_PS, 0, rdsparser_get_ps(rds), RDSPARSER_PS_LENGTH);
+}
+
+static void
+rdsparser_event_rt(rdsparser_t         *rds,
+                   rdsparser_rt_flag_t  flag,
+                   void                *user_data)
+{
+    rdsparser_event_emit_string(rds, RDSPARSER_EVENT_RT, RDSPARSER_TEXT_RT, flag, rdsparser_get_rt(rds, flag), RDSPARSER_RT_LENGTH);
+}
+
+static void
+rdsparser_event_rt_complete(rdsparser_t         *rds,
+                            rdsparser_rt_flag_t  flag,
+                            void                *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_RT_COMPLETE, flag, 0);
+}
+
+static void
+rdsparser_event_ptyn(rdsparser_t *rds,
+                     void        *user_data)
+{
+    rdsparser_event_emit_string(rds, RDSPARSER_EVENT_PTYN, RDSPARSER_TEXT_PTYN, 0, rdsparser_get_ptyn(rds), RDSPARSER_PTYN_LENGTH);
+}
+
+static void
+rdsparser_event_lps(rdsparser_t *rds,
+                    void        *user_data)
+{
+    rdsparser_event_emit_string(rds, RDSPARSER_EVENT_LPS, RDSPARSER_TEXT_LPS, 0, rdsparser_get_lps(rds), RDSPARSER_LPS_LENGTH);
+}
+
+static void
+rdsparser_event_ert(rdsparser_t *rds,
+                    void        *user_data)
+{
+    rdsparser_event_emit_string(rds, RDSPARSER_EVENT_ERT, RDSPARSER_TEXT_ERT, 0, rdsparser_get_ert(rds), RDSPARSER_ERT_LENGTH);
+}
+
+#ifndef RDSPARSER_DISABLE_GROUP4
+static void
+rdsparser_event_ct(rdsparser_t          *rds,
+                   const rdsparser_ct_t *ct,
+                   void                 *user_data)
+{
+    /* Local offset in half-hours */
+    const int8_t offset = (int8_t)(rdsparser_ct_get_offset(ct) / 30);
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_CT, (uint8_t)offset, rdsparser_ct_get_epoch(ct));
+}
+#endif
+
+static void
+rdsparser_event_eon(rdsparser_t           *rds,
+                    const rdsparser_eon_t *eon,
+                    void                  *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_EON, 0, rdsparser_eon_get_pi(eon));
+}
+
+static void
+rdsparser_event_eon_ta(rdsparser_t           *rds,
+                       const rdsparser_eon_t *eon,
+                       void                  *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_EON_TA, (uint8_t)rdsparser_eon_get_ta(eon), rdsparser_eon_get_pi(eon));
+}
+
+static void
+rdsparser_event_rtplus(rdsparser_t                  *rds,
+                       const rdsparser_rtplus_tag_t *tag,
+                       void                         *user_data)
+{
+    const rdsparser_event_t event =
+    {
+        .type = RDSPARSER_EVENT_RTPLUS,
+        .index = rdsparser_rtplus_tag_get_type(tag),
+        .start = rdsparser_rtplus_tag_get_start(tag),
+        .length = rdsparser_rtplus_tag_get_length(tag),
+        .value = rdsparser_rtplus_tag_get_flag(tag)
+    };
+
+    rdsparser_event_push(&rds->events, &event);
+}
+
+static void
+rdsparser_event_oda(rdsparser_t *rds,
+                    uint8_t      group,
+                    bool         flag,
+                    uint16_t     aid,
+                    void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_ODA, (uint8_t)((group << 1) | flag), aid);
+}
+
+static void
+rdsparser_event_tmc(rdsparser_t *rds,
+                    void        *user_data)
+{
+    rdsparser_event_emit(rds, RDSPARSER_EVENT_TMC, 0, rdsparser_get_tmc_pending(rds));
+}
+
+/* Shared by all contexts with the event queue enabled */
+static const rdsparser_handlers_t rdsparser_event_handlers =
+{
+    .pi = rdsparser_event_pi,
+    .pty = rdsparser_event_pty,
+    .tp = rdsparser_event_tp,
+    .ta = rdsparser_event_ta,
+    .ms = rdsparser_event_ms,
+    .ecc = rdsparser_event_ecc,
+    .country = rdsparser_event_country,
+    .pin = rdsparser_event_pin,
+    .la = rdsparser_event_la,
+    .slc = rdsparser_event_slc,
+    .af = rdsparser_event_af,
+    .af_expire = rdsparser_event_af_expire,
+    .ps = rdsparser_event_ps,
+    .rt = rdsparser_event_rt,
+    .rt_complete = rdsparser_event_rt_complete,
+    .ptyn = rdsparser_event_ptyn,
+    .lps = rdsparser_event_lps,
+    .ert = rdsparser_event_ert,
+#ifndef RDSPARSER_DISABLE_GROUP4
+    .ct = rdsparser_event_ct,
+#endif
+    .eon = rdsparser_event_eon,
+    .eon_ta = rdsparser_event_eon_ta,
+    .rtplus = rdsparser_event_rtplus,
+    .oda_announce = rdsparser_event_oda,
+    .tmc = rdsparser_event_tmc
+};
+
+bool
+rdsparser_set_events(rdsparser_t *rds,
+                     bool         state)
+{
+    rdsparser_event_queue_t *queue = &rds->events;
+
+    if (state == (queue->event != NULL))
+    {
+        return true;
+    }
+
+    if (!state)
+    {
+        rdsparser_set_handlers(rds, NULL);
+#ifndef RDSPARSER_DISABLE_HEAP
+        free(queue->event);
+#endif
+        queue->event = NULL;
+        return true;
+    }
+
+#ifndef RDSPARSER_DISABLE_HEAP
+    queue->event = malloc(RDSPARSER_EVENT_QUEUE_SIZE * sizeof(rdsparser_event_t));
+    if (queue->event == NULL)
+    {
+        return false;
+    }
+#else
+    queue->event = rds->events_buffer;
+#endif
+
+    queue->head = 0;
+    queue->tail = 0;
+    queue->overflow = 0;
+    rdsparser_event_clear_range(queue);
+    rdsparser_set_handlers(rds, &rdsparser_event_handlers);
+    return true;
+}
+
+bool
+rdsparser_get_events(const rdsparser_t *rds)
+{
+    return (rds->events.event != NULL);
+}
+
+bool
+rdsparser_pop_event(rdsparser_t       *rds,
+                    rdsparser_event_t *event)
+{
+    rdsparser_event_queue_t *queue = &rds->events;
+    const uint32_t tail = queue->tail;
+
+    if (queue->event == NULL ||
+        tail == rdsparser_event_load(&queue->head))
+    {
+        return false;
+    }
+
+    *event = queue->event[tail % RDSPARSER_EVENT_QUEUE_SIZE];
+    rdsparser_event_store(&queue->tail, tail + 1);
+    return true;
+}
+
+size_t
+rdsparser_poll_events(rdsparser_t       *rds,
+                      rdsparser_event_t *out,
+                      size_t             cap)
+{
+    rdsparser_event_queue_t *queue = &rds->events;
+    const uint32_t tail = queue->tail;
+    size_t count;
+
+    if (queue->event == NULL)
+    {
+        return 0;
+    }
+
+    /* Take the whole batch with a single acquire/release pair */
+    count = rdsparser_event_load(&queue->head) - tail;
+    if (count > cap)
+    {
+        count = cap;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = queue->event[(tail + i) % RDSPARSER_EVENT_QUEUE_SIZE];
+    }
+
+    rdsparser_event_store(&queue->tail, tail + (uint32_t)count);
+    return count;
+}
+
+uint32_t
+rdsparser_get_event_overflow(const rdsparser_t *rds)
+{
+    return rdsparser_event_load(&rds->events.overflow);
+}
@@ -0,0 +1,25 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_EVENT_H
+#define RDSPARSER_EVENT_H
+#include <librdsparser_private.h>
+
+void rdsparser_event_clear_range(rdsparser_event_queue_t *queue);
+void rdsparser_event_range(rdsparser_event_queue_t *queue, rdsparser_text_t text, uint8_t position);
+bool rdsparser_event_push(rdsparser_event_queue_t *queue, const rdsparser_event_t *event);
+
+#endif
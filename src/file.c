@@ -0,0 +1,168 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef _WIN32
+#define _DEFAULT_SOURCE
+#endif
+#include <stdint.h>
+#include <stdbool.h>
+#include <librdsparser_private.h>
+#include "log.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+static int64_t
+rdsparser_file_parse(rdsparser_t *rds,
+                     const char  *data,
+                     size_t       length)
+{
+    if (rdsparser_log_detect((const uint8_t*)data, length))
+    {
+        return rdsparser_parse_log(rds, (const uint8_t*)data, length);
+    }
+
+    return (int64_t)rdsparser_parse_buffer(rds, data, length);
+}
+
+#ifdef _WIN32
+bool
+rdsparser_file_map(const char  *path,
+                   const char **data,
+                   size_t      *length)
+{
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    *data = NULL;
+    *length = (size_t)size.QuadPart;
+    if (*length == 0)
+    {
+        /* Nothing to map */
+        CloseHandle(file);
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    /* The view stays valid after both handles are closed */
+    *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return (*data != NULL);
+}
+
+void
+rdsparser_file_unmap(const char *data,
+                     size_t      length)
+{
+    (void)length;
+    if (data)
+    {
+        UnmapViewOfFile(data);
+    }
+}
+#else
+bool
+rdsparser_file_map(const char  *path,
+                   const char **data,
+                   size_t      *length)
+{
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    *data = NULL;
+    *length = (size_t)st.st_size;
+    if (*length == 0)
+    {
+        /* Nothing to map */
+        close(fd);
+        return true;
+    }
+
+    void *mapping = mmap(NULL, *length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    /* The captures are read only once, from the beginning to the end */
+    madvise(mapping, *length, MADV_SEQUENTIAL);
+
+    *data = mapping;
+    return true;
+}
+
+void
+rdsparser_file_unmap(const char *data,
+                     size_t      length)
+{
+    if (data)
+    {
+        munmap((void*)data, length);
+    }
+}
+#endif
+
+int64_t
+rdsparser_parse_file(rdsparser_t *rds,
+                     const char  *path)
+{
+    const char *data;
+    size_t length;
+
+    if (!rdsparser_file_map(path, &data, &length))
+    {
+        return -1;
+    }
+
+    const int64_t count = (length ? rdsparser_file_parse(rds, data, length) : 0);
+
+    rdsparser_file_unmap(data, length);
+    return count;
+}
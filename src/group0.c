@@ -37,6 +37,7 @@ rdsparser_group0_get_ps_pos(const rdsparser_data_t data)
     return data[RDSPARSER_BLOCK_B] & 3;
 }
 
+#ifndef RDSPARSER_DISABLE_AF
 static inline uint8_t
 rdsparser_group0a_get_af1(const rdsparser_data_t data)
 {
@@ -71,6 +72,7 @@ rdsparser_group0a_parse(rdsparser_t             *rds,
         rdsparser_add_af(rds, af2);
     }
 }
+#endif
 
 void
 rdsparser_group0_parse(rdsparser_t             *rds,
@@ -94,16 +96,18 @@ rdsparser_group0_parse(rdsparser_t             *rds,
                                                   position);
 
     if (changed &&
-        rds->callback_ps)
+        rds->handlers->ps)
     {
-        rds->callback_ps(rds,
-                         rds->user_data);
+        rds->handlers->ps(rds,
+                          rds->user_data);
     }
 
+#ifndef RDSPARSER_DISABLE_AF
     if (flag == RDSPARSER_GROUP_FLAG_A)
     {
         rdsparser_group0a_parse(rds, data, errors);
     }
+#endif
 }
 
 
@@ -18,18 +18,53 @@
 #include "rdsparser.h"
 #include "ecc.h"
 
+static inline rdsparser_la_t
+rdsparser_group1a_get_la(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] & 0x8000) >> 15;
+}
+
 static inline uint8_t
 rdsparser_group1a_get_variant(const rdsparser_data_t data)
 {
     return (data[RDSPARSER_BLOCK_C] & 0x7000) >> 12;
 }
 
+static inline rdsparser_slc_t
+rdsparser_group1a_get_slc(const rdsparser_data_t data)
+{
+    return (rdsparser_slc_t)(data[RDSPARSER_BLOCK_C] & 0x0FFF);
+}
+
 static inline uint8_t
 rdsparser_group1a0_get_ecc(const rdsparser_data_t data)
 {
     return (uint8_t)data[RDSPARSER_BLOCK_C];
 }
 
+static inline rdsparser_pin_t
+rdsparser_group1_get_pin(const rdsparser_data_t data)
+{
+    return (rdsparser_pin_t)data[RDSPARSER_BLOCK_D];
+}
+
+static inline void
+rdsparser_group1_parse_pin(rdsparser_t             *rds,
+                           const rdsparser_data_t   data,
+                           const rdsparser_error_t  errors)
+{
+    if (errors[RDSPARSER_BLOCK_B] == 0 &&
+        errors[RDSPARSER_BLOCK_D] == 0)
+    {
+        rdsparser_pin_t pin = rdsparser_group1_get_pin(data);
+        if (rdsparser_pin_get_day(pin) != 0)
+        {
+            /* Day 0 indicates no valid PIN */
+            rdsparser_set_pin(rds, pin);
+        }
+    }
+}
+
 static inline void
 rdsparser_group1a_parse(rdsparser_t             *rds,
                         const rdsparser_data_t   data,
@@ -38,13 +73,20 @@ rdsparser_group1a_parse(rdsparser_t             *rds,
     if (errors[RDSPARSER_BLOCK_B] == 0 &&
         errors[RDSPARSER_BLOCK_C] == 0)
     {
-        if (rdsparser_group1a_get_variant(data) == 0)
+        const uint8_t variant = rdsparser_group1a_get_variant(data);
+
+        rdsparser_set_la(rds, rdsparser_group1a_get_la(data));
+        rdsparser_set_slc(rds, variant, rdsparser_group1a_get_slc(data));
+
+        if (variant == RDSPARSER_SLC_PAGING_ECC)
         {
             uint8_t ecc = rdsparser_group1a0_get_ecc(data);
             rdsparser_set_ecc(rds, ecc);
             rdsparser_set_country(rds, rdsparser_ecc_lookup(rdsparser_get_pi(rds), ecc));
         }
     }
+
+    rdsparser_group1_parse_pin(rds, data, errors);
 }
 
 void
@@ -57,4 +99,8 @@ rdsparser_group1_parse(rdsparser_t             *rds,
     {
         rdsparser_group1a_parse(rds, data, errors);
     }
+    else
+    {
+        rdsparser_group1_parse_pin(rds, data, errors);
+    }
 }
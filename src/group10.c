@@ -50,9 +50,9 @@ rdsparser_group10a_parse(rdsparser_t             *rds,
                                               position + 2);
 
     if (changed &&
-        rds->callback_ptyn)
+        rds->handlers->ptyn)
     {
-        rds->callback_ptyn(rds, rds->user_data);
+        rds->handlers->ptyn(rds, rds->user_data);
     }
 }
 
@@ -0,0 +1,175 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <librdsparser_private.h>
+#include "parser.h"
+#include "eon.h"
+
+static inline bool
+rdsparser_group14_get_tp_on(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_B] & 0x10) >> 4;
+}
+
+static inline uint16_t
+rdsparser_group14_get_pi_on(const rdsparser_data_t data)
+{
+    return data[RDSPARSER_BLOCK_D];
+}
+
+static inline uint8_t
+rdsparser_group14a_get_variant(const rdsparser_data_t data)
+{
+    return data[RDSPARSER_BLOCK_B] & 0xF;
+}
+
+static inline uint8_t
+rdsparser_group14a_get_high(const rdsparser_data_t data)
+{
+    return data[RDSPARSER_BLOCK_C] >> 8;
+}
+
+static inline uint8_t
+rdsparser_group14a_get_low(const rdsparser_data_t data)
+{
+    return (uint8_t)data[RDSPARSER_BLOCK_C];
+}
+
+static inline uint8_t
+rdsparser_group14a_get_pty_on(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] & 0xF800) >> 11;
+}
+
+static inline bool
+rdsparser_group14a_get_ta_on(const rdsparser_data_t data)
+{
+    return data[RDSPARSER_BLOCK_C] & 1;
+}
+
+static inline bool
+rdsparser_group14b_get_ta_on(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_B] & 0x8) >> 3;
+}
+
+static inline void
+rdsparser_group14_notify_ta(rdsparser_t           *rds,
+                            const rdsparser_eon_t *eon)
+{
+    if (rds->handlers->eon_ta)
+    {
+        rds->handlers->eon_ta(rds, eon, rds->user_data);
+    }
+}
+
+static inline bool
+rdsparser_group14a_parse(rdsparser_t             *rds,
+                         rdsparser_eon_t         *eon,
+                         const rdsparser_data_t   data,
+                         const rdsparser_error_t  errors)
+{
+    const uint8_t variant = rdsparser_group14a_get_variant(data);
+
+    if (variant <= 3)
+    {
+        return rdsparser_parser_update_string(rds,
+                                              eon->ps,
+                                              RDSPARSER_TEXT_PS,
+                                              RDSPARSER_BLOCK_C,
+                                              data,
+                                              errors,
+                                              2 * variant);
+    }
+
+    if (errors[RDSPARSER_BLOCK_C] != 0)
+    {
+        return false;
+    }
+
+    bool changed = false;
+    switch (variant)
+    {
+#ifndef RDSPARSER_DISABLE_AF
+        case 4:
+            /* AF(ON) list, method A */
+            changed |= rdsparser_eon_add_af(eon, rdsparser_group14a_get_high(data));
+            changed |= rdsparser_eon_add_af(eon, rdsparser_group14a_get_low(data));
+            break;
+#endif
+
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+            /* Tuning frequency (TN) and mapped FM frequency (ON) */
+            changed = rdsparser_eon_add_mapping(eon,
+                                                rdsparser_group14a_get_high(data),
+                                                rdsparser_group14a_get_low(data));
+            break;
+
+        case 13:
+            changed |= rdsparser_eon_update_pty(eon, rdsparser_group14a_get_pty_on(data));
+            if (rdsparser_eon_update_ta(eon, rdsparser_group14a_get_ta_on(data)))
+            {
+                rdsparser_group14_notify_ta(rds, eon);
+                changed = true;
+            }
+            break;
+    }
+
+    return changed;
+}
+
+void
+rdsparser_group14_parse(rdsparser_t             *rds,
+                        const rdsparser_data_t   data,
+                        const rdsparser_error_t  errors,
+                        rdsparser_group_flag_t   flag)
+{
+    if (errors[RDSPARSER_BLOCK_B] != 0 ||
+        errors[RDSPARSER_BLOCK_D] != 0)
+    {
+        /* Variant and PI(ON) are required */
+        return;
+    }
+
+    rdsparser_eon_t *eon = rdsparser_eon_table_insert(&rds->eon, rdsparser_group14_get_pi_on(data));
+    if (eon == NULL)
+    {
+        return;
+    }
+
+    bool changed = rdsparser_eon_update_tp(eon, rdsparser_group14_get_tp_on(data));
+
+    if (flag == RDSPARSER_GROUP_FLAG_A)
+    {
+        changed |= rdsparser_group14a_parse(rds, eon, data, errors);
+    }
+    else if (rdsparser_eon_update_ta(eon, rdsparser_group14b_get_ta_on(data)))
+    {
+        /* Switch to the traffic announcement
+           should happen as soon as possible */
+        rdsparser_group14_notify_ta(rds, eon);
+        changed = true;
+    }
+
+    if (changed &&
+        rds->handlers->eon)
+    {
+        rds->handlers->eon(rds, eon, rds->user_data);
+    }
+}
@@ -18,6 +18,9 @@
 #include "rdsparser.h"
 #include "parser.h"
 #include "string.h"
+#include "rtplus.h"
+#include "event.h"
+#include "json.h"
 
 static inline uint8_t
 rdsparser_group2_get_rt_pos(const rdsparser_data_t data)
@@ -31,6 +34,107 @@ rdsparser_group2_get_rt_flag(const rdsparser_data_t data)
     return (data[RDSPARSER_BLOCK_B] & 16) >> 4;
 }
 
+void
+rdsparser_rt_state_clear(rdsparser_rt_state_t *state)
+{
+    state->segments = 0;
+    state->complete = false;
+}
+
+static bool
+rdsparser_group2_segment_received(const rdsparser_string_t  *string,
+                                  uint8_t                    start,
+                                  uint8_t                    end,
+                                  rdsparser_string_error_t   threshold)
+{
+    const rdsparser_string_error_t *errors = rdsparser_string_get_errors(string);
+
+    for (uint8_t i = start; i < end; i++)
+    {
+        if (errors[i] > threshold)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool
+rdsparser_group2_check_complete(const rdsparser_string_t *string,
+                                uint16_t                  segments,
+                                uint8_t                   segment_length)
+{
+    const rdsparser_string_char_t *content = rdsparser_string_get_content(string);
+    const uint8_t segment_count = 16;
+    uint8_t last = segment_count - 1;
+
+    /* The text ends at the first received line ending or fills the buffer */
+    for (uint8_t segment = 0; segment < segment_count; segment++)
+    {
+        if (!(segments & (1 << segment)))
+        {
+            continue;
+        }
+
+        const uint8_t start = segment * segment_length;
+        for (uint8_t i = start; i < start + segment_length; i++)
+        {
+            if (content[i] == '\0')
+            {
+                last = segment;
+                break;
+            }
+        }
+
+        if (last != segment_count - 1)
+        {
+            break;
+        }
+    }
+
+    const uint16_t mask = (uint16_t)((1u << (last + 1)) - 1);
+    return ((segments & mask) == mask);
+}
+
+static bool
+rdsparser_group2_update_state(rdsparser_t          *rds,
+                              rdsparser_rt_flag_t   rt_flag,
+                              uint8_t               segment,
+                              uint8_t               segment_length,
+                              bool                  segment_changed)
+{
+    rdsparser_rt_state_t *state = &rds->rt_state[RDSPARSER_RT_BUFFER(rt_flag)];
+    const uint8_t start = segment * segment_length;
+
+    if (rdsparser_group2_segment_received(rds->rt[RDSPARSER_RT_BUFFER(rt_flag)],
+                                          start,
+                                          start + segment_length,
+                                          rds->rt_complete_threshold))
+    {
+        state->segments |= (1 << segment);
+    }
+    else
+    {
+        state->segments &= ~(1 << segment);
+    }
+
+    if (segment_changed)
+    {
+        /* New content, report the text again once completed */
+        state->complete = false;
+    }
+
+    if (!state->complete &&
+        rdsparser_group2_check_complete(rds->rt[RDSPARSER_RT_BUFFER(rt_flag)], state->segments, segment_length))
+    {
+        state->complete = true;
+        return true;
+    }
+
+    return false;
+}
+
 void
 rdsparser_group2_parse(rdsparser_t             *rds,
                        const rdsparser_data_t   data,
@@ -44,12 +148,17 @@ rdsparser_group2_parse(rdsparser_t             *rds,
         rt_flag != rds->last_rt_flag)
     {
         if (rds->last_rt_flag != -1 &&
-            rdsparser_string_get_available(rds->rt[rt_flag]))
+            rdsparser_string_get_available(rds->rt[RDSPARSER_RT_BUFFER(rt_flag)]))
         {
-            rdsparser_string_clear(rds->rt[rt_flag]);
+            rdsparser_string_clear(rds->rt[RDSPARSER_RT_BUFFER(rt_flag)]);
+            rdsparser_event_range(&rds->events, RDSPARSER_TEXT_RT, 0);
+            rdsparser_event_range(&rds->events, RDSPARSER_TEXT_RT, RDSPARSER_RT_LENGTH - 2);
+            rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_RT));
+            rdsparser_rtplus_update_text(rds, rt_flag, 0, RDSPARSER_RT_LENGTH);
             changed = true;
         }
 
+        rdsparser_rt_state_clear(&rds->rt_state[RDSPARSER_RT_BUFFER(rt_flag)]);
         rds->last_rt_flag = rt_flag;
     }
 
@@ -63,36 +172,61 @@ rdsparser_group2_parse(rdsparser_t             *rds,
     }
 
     uint8_t position;
+    uint8_t start;
+    bool segment_changed = false;
     if (flag == RDSPARSER_GROUP_FLAG_A)
     {
         position = 4 * rdsparser_group2_get_rt_pos(data);
-        changed |= rdsparser_parser_update_string(rds,
-                                                  rds->rt[rt_flag],
-                                                  RDSPARSER_TEXT_RT,
-                                                  RDSPARSER_BLOCK_C,
-                                                  data,
-                                                  errors,
-                                                  position);
+        segment_changed = rdsparser_parser_update_string(rds,
+                                                         rds->rt[RDSPARSER_RT_BUFFER(rt_flag)],
+                                                         RDSPARSER_TEXT_RT,
+                                                         RDSPARSER_BLOCK_C,
+                                                         data,
+                                                         errors,
+                                                         position);
+        start = position;
         position += 2;
     }
     else
     {
         position = 2 * rdsparser_group2_get_rt_pos(data);
+        start = position;
     }
 
-    changed |= rdsparser_parser_update_string(rds,
-                                              rds->rt[rt_flag],
-                                              RDSPARSER_TEXT_RT,
-                                              RDSPARSER_BLOCK_D,
-                                              data,
-                                              errors,
-                                              position);
+    segment_changed |= rdsparser_parser_update_string(rds,
+                                                      rds->rt[RDSPARSER_RT_BUFFER(rt_flag)],
+                                                      RDSPARSER_TEXT_RT,
+                                                      RDSPARSER_BLOCK_D,
+                                                      data,
+                                                      errors,
+                                                      position);
+
+    const bool completed = rdsparser_group2_update_state(rds,
+                                                         rt_flag,
+                                                         rdsparser_group2_get_rt_pos(data),
+                                                         (flag == RDSPARSER_GROUP_FLAG_A) ? 4 : 2,
+                                                         segment_changed);
+
+    if (segment_changed)
+    {
+        /* Only tags covering the received segment need to be updated */
+        rdsparser_rtplus_update_text(rds, rt_flag, start, position + 2);
+        changed = true;
+    }
 
     if (changed &&
-        rds->callback_rt)
+        rds->handlers->rt)
+    {
+        rds->handlers->rt(rds,
+                          rt_flag,
+                          rds->user_data);
+    }
+
+    if (completed &&
+        rds->handlers->rt_complete)
     {
-        rds->callback_rt(rds,
-                         rt_flag,
-                         rds->user_data);
+        rds->handlers->rt_complete(rds,
+                                   rt_flag,
+                                   rds->user_data);
     }
 }
@@ -18,6 +18,7 @@
 #define RDSPARSER_GROUP2_H
 #include <librdsparser_private.h>
 
+void rdsparser_rt_state_clear(rdsparser_rt_state_t *state);
 void rdsparser_group2_parse(rdsparser_t *rds, const rdsparser_data_t data, const rdsparser_error_t errors, rdsparser_group_flag_t flag);
 
 #endif
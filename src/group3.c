@@ -0,0 +1,63 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <librdsparser_private.h>
+#include "group3.h"
+#include "oda.h"
+
+#define RDSPARSER_GROUP3_APP_GROUP_NONE  0x00
+#define RDSPARSER_GROUP3_APP_GROUP_FAULT 0x1F
+
+static inline uint8_t
+rdsparser_group3a_get_app_group(const rdsparser_data_t data)
+{
+    /* Group type code (4 bits) and version (1 bit) */
+    return data[RDSPARSER_BLOCK_B] & 0x1F;
+}
+
+static inline uint16_t
+rdsparser_group3a_get_aid(const rdsparser_data_t data)
+{
+    return data[RDSPARSER_BLOCK_D];
+}
+
+void
+rdsparser_group3_parse(rdsparser_t             *rds,
+                       const rdsparser_data_t   data,
+                       const rdsparser_error_t  errors,
+                       rdsparser_group_flag_t   flag)
+{
+    if (flag != RDSPARSER_GROUP_FLAG_A ||
+        errors[RDSPARSER_BLOCK_B] != 0 ||
+        errors[RDSPARSER_BLOCK_D] != 0)
+    {
+        return;
+    }
+
+    const uint8_t app_group = rdsparser_group3a_get_app_group(data);
+    if (app_group == RDSPARSER_GROUP3_APP_GROUP_NONE ||
+        app_group == RDSPARSER_GROUP3_APP_GROUP_FAULT)
+    {
+        return;
+    }
+
+    const uint16_t aid = rdsparser_group3a_get_aid(data);
+    if (rdsparser_oda_announce(&rds->oda, app_group, aid) &&
+        rds->handlers->oda_announce)
+    {
+        rds->handlers->oda_announce(rds, app_group >> 1, app_group & 1, aid, rds->user_data);
+    }
+}
@@ -16,6 +16,7 @@
 
 #include <librdsparser_private.h>
 #include "ct.h"
+#include "json.h"
 
 static inline uint32_t
 rdsparser_group4a_get_mjd(const rdsparser_data_t data)
@@ -66,10 +67,23 @@ rdsparser_group4a_parse(rdsparser_t             *rds,
         int8_t offset = rdsparser_group4a_get_time_offset(data);
 
         rdsparser_ct_t ct;
-        if (rds->callback_ct &&
-            rdsparser_ct_init(&ct, mjd, hour, minute, offset))
+        if (!rdsparser_ct_init(&ct, mjd, hour, minute, offset))
         {
-            rds->callback_ct(rds, &ct, rds->user_data);
+            return;
+        }
+
+        if (rds->ct_filter_enabled &&
+            !rdsparser_ct_filter_check(&rds->ct_filter, &ct, rds->groups))
+        {
+            /* Not consistent with the previous time */
+            return;
+        }
+
+        rdsparser_json_set_ct(&rds->json, &ct);
+
+        if (rds->handlers->ct)
+        {
+            rds->handlers->ct(rds, &ct, rds->user_data);
         }
     }
 }
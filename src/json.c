@@ -0,0 +1,384 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <librdsparser_private.h>
+#include "json.h"
+
+/* Longest string (RT) with four UTF-8 bytes per character */
+#define RDSPARSER_JSON_UTF8_SIZE (RDSPARSER_RT_LENGTH * 4 + 1)
+
+typedef struct rdsparser_json_writer
+{
+    char *buffer;
+    size_t size;
+    size_t length;
+    bool overflow;
+    bool first;
+} rdsparser_json_writer_t;
+
+void
+rdsparser_json_clear(rdsparser_json_t *json)
+{
+    /* Everything has to be sent again after a reset */
+    json->dirty = RDSPARSER_JSON_DIRTY_ALL;
+    json->ct = false;
+    json->ct_epoch = 0;
+    json->ct_offset = 0;
+}
+
+void
+rdsparser_json_mark(rdsparser_json_t *json,
+                    uint32_t          mask)
+{
+    json->dirty |= mask;
+}
+
+#ifndef RDSPARSER_DISABLE_GROUP4
+void
+rdsparser_json_set_ct(rdsparser_json_t     *json,
+                      const rdsparser_ct_t *ct)
+{
+    json->ct = true;
+    json->ct_epoch = rdsparser_ct_get_epoch(ct);
+    json->ct_offset = rdsparser_ct_get_offset(ct);
+    json->dirty |= RDSPARSER_JSON_DIRTY_CT;
+}
+#endif
+
+static void
+rdsparser_json_put(rdsparser_json_writer_t *writer,
+                   char                     c)
+{
+    /* Always keep space for the terminating null */
+    if (writer->length + 1 < writer->size)
+    {
+        writer->buffer[writer->length++] = c;
+    }
+    else
+    {
+        writer->overflow = true;
+    }
+}
+
+static void
+rdsparser_json_raw(rdsparser_json_writer_t *writer,
+                   const char              *string)
+{
+    while (*string)
+    {
+        rdsparser_json_put(writer, *string++);
+    }
+}
+
+static void
+rdsparser_json_int(rdsparser_json_writer_t *writer,
+                   int64_t                  value)
+{
+    char digits[20];
+    uint8_t count = 0;
+    uint64_t magnitude = (value < 0) ? -(uint64_t)value : (uint64_t)value;
+
+    if (value < 0)
+    {
+        rdsparser_json_put(writer, '-');
+    }
+
+    do
+    {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+
+    while (count)
+    {
+        rdsparser_json_put(writer, digits[--count]);
+    }
+}
+
+static void
+rdsparser_json_key(rdsparser_json_writer_t *writer,
+                   const char              *key)
+{
+    if (!writer->first)
+    {
+        rdsparser_json_put(writer, ',');
+    }
+
+    writer->first = false;
+    rdsparser_json_put(writer, '"');
+    rdsparser_json_raw(writer, key);
+    rdsparser_json_raw(writer, "\":");
+}
+
+static void
+rdsparser_json_number(rdsparser_json_writer_t *writer,
+                      const char              *key,
+                      int64_t                  value,
+                      bool                     known)
+{
+    rdsparser_json_key(writer, key);
+
+    if (known)
+    {
+        rdsparser_json_int(writer, value);
+    }
+    else
+    {
+        rdsparser_json_raw(writer, "null");
+    }
+}
+
+static void
+rdsparser_json_text(rdsparser_json_writer_t  *writer,
+                    const rdsparser_string_t *string)
+{
+    static const char hex[] = "0123456789abcdef";
+    char text[RDSPARSER_JSON_UTF8_SIZE];
+
+    if (!rdsparser_string_get_available(string))
+    {
+        rdsparser_json_raw(writer, "null");
+        return;
+    }
+
+    const size_t length = rdsparser_string_get_utf8(string, text, sizeof(text));
+
+    rdsparser_json_put(writer, '"');
+    for (size_t i = 0; i < length; i++)
+    {
+        const unsigned char c = (unsigned char)text[i];
+
+        if (c == '"' || c == '\\')
+        {
+            rdsparser_json_put(writer, '\\');
+            rdsparser_json_put(writer, (char)c);
+        }
+        else if (c < 0x20)
+        {
+            rdsparser_json_raw(writer, "\\u00");
+            rdsparser_json_put(writer, hex[c >> 4]);
+            rdsparser_json_put(writer, hex[c & 0xF]);
+        }
+        else
+        {
+            rdsparser_json_put(writer, (char)c);
+        }
+    }
+    rdsparser_json_put(writer, '"');
+}
+
+static void
+rdsparser_json_errors(rdsparser_json_writer_t  *writer,
+                      const rdsparser_string_t *string)
+{
+    const rdsparser_string_error_t *errors = rdsparser_string_get_errors(string);
+    const uint8_t length = rdsparser_string_get_length(string);
+
+    rdsparser_json_put(writer, '[');
+    for (uint8_t i = 0; i < length; i++)
+    {
+        if (i)
+        {
+            rdsparser_json_put(writer, ',');
+        }
+        rdsparser_json_int(writer, errors[i]);
+    }
+    rdsparser_json_put(writer, ']');
+}
+
+static void
+rdsparser_json_string(rdsparser_json_writer_t  *writer,
+                      const char               *key,
+                      const rdsparser_string_t *string,
+                      unsigned                  flags)
+{
+    rdsparser_json_key(writer, key);
+    rdsparser_json_text(writer, string);
+
+    if (flags & RDSPARSER_JSON_ERRORS)
+    {
+        /* Same key with the _errors suffix */
+        rdsparser_json_put(writer, ',');
+        rdsparser_json_put(writer, '"');
+        rdsparser_json_raw(writer, key);
+        rdsparser_json_raw(writer, "_errors\":");
+        rdsparser_json_errors(writer, string);
+    }
+}
+
+static size_t
+rdsparser_json_write(rdsparser_t *rds,
+                     char        *buffer,
+                     size_t       size,
+                     unsigned     flags,
+                     uint32_t     mask)
+{
+    rdsparser_json_writer_t writer = { buffer, size, 0, false, true };
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    rdsparser_json_put(&writer, '{');
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PI))
+    {
+        const rdsparser_pi_t pi = rdsparser_get_pi(rds);
+        rdsparser_json_number(&writer, "pi", pi, pi != RDSPARSER_PI_UNKNOWN);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PTY))
+    {
+        const rdsparser_pty_t pty = rdsparser_get_pty(rds);
+        rdsparser_json_number(&writer, "pty", pty, pty != RDSPARSER_PTY_UNKNOWN);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_TP))
+    {
+        const rdsparser_tp_t tp = rdsparser_get_tp(rds);
+        rdsparser_json_number(&writer, "tp", tp, tp != RDSPARSER_TP_UNKNOWN);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_TA))
+    {
+        const rdsparser_ta_t ta = rdsparser_get_ta(rds);
+        rdsparser_json_number(&writer, "ta", ta, ta != RDSPARSER_TA_UNKNOWN);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_MS))
+    {
+        const rdsparser_ms_t ms = rdsparser_get_ms(rds);
+        rdsparser_json_number(&writer, "ms", ms, ms != RDSPARSER_MS_UNKNOWN);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_ECC))
+    {
+        const rdsparser_ecc_t ecc = rdsparser_get_ecc(rds);
+        rdsparser_json_number(&writer, "ecc", ecc, ecc != RDSPARSER_ECC_UNKNOWN);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY_COUNTRY)
+    {
+        const rdsparser_country_t country = rdsparser_get_country(rds);
+        rdsparser_json_number(&writer, "country", country, country != RDSPARSER_COUNTRY_UNKNOWN);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY_AF)
+    {
+        const rdsparser_af_t *af = rdsparser_get_af(rds);
+        bool first = true;
+
+        rdsparser_json_key(&writer, "af");
+        rdsparser_json_put(&writer, '[');
+        for (uint32_t frequency = rdsparser_af_next(af, 0);
+             frequency;
+             frequency = rdsparser_af_next(af, frequency))
+        {
+            if (!first)
+            {
+                rdsparser_json_put(&writer, ',');
+            }
+            first = false;
+            rdsparser_json_int(&writer, frequency);
+        }
+        rdsparser_json_put(&writer, ']');
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PS))
+    {
+        rdsparser_json_string(&writer, "ps", rds->ps, flags);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_RT))
+    {
+        rdsparser_json_key(&writer, "rt");
+        rdsparser_json_put(&writer, '[');
+        rdsparser_json_text(&writer, rds->rt[0]);
+#ifndef RDSPARSER_DISABLE_RT_B
+        rdsparser_json_put(&writer, ',');
+        rdsparser_json_text(&writer, rds->rt[1]);
+#endif
+        rdsparser_json_put(&writer, ']');
+
+        if (flags & RDSPARSER_JSON_ERRORS)
+        {
+            rdsparser_json_key(&writer, "rt_errors");
+            rdsparser_json_put(&writer, '[');
+            rdsparser_json_errors(&writer, rds->rt[0]);
+#ifndef RDSPARSER_DISABLE_RT_B
+            rdsparser_json_put(&writer, ',');
+            rdsparser_json_errors(&writer, rds->rt[1]);
+#endif
+            rdsparser_json_put(&writer, ']');
+        }
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PTYN))
+    {
+        rdsparser_json_string(&writer, "ptyn", rds->ptyn, flags);
+    }
+
+    if (mask & RDSPARSER_JSON_DIRTY_CT)
+    {
+        rdsparser_json_key(&writer, "ct");
+        if (rds->json.ct)
+        {
+            rdsparser_json_raw(&writer, "{\"epoch\":");
+            rdsparser_json_int(&writer, rds->json.ct_epoch);
+            rdsparser_json_raw(&writer, ",\"offset\":");
+            rdsparser_json_int(&writer, rds->json.ct_offset);
+            rdsparser_json_put(&writer, '}');
+        }
+        else
+        {
+            rdsparser_json_raw(&writer, "null");
+        }
+    }
+
+    rdsparser_json_put(&writer, '}');
+
+    if (writer.overflow)
+    {
+        /* Never leave a truncated document, the changes are kept for the next call */
+        buffer[0] = '\0';
+        return 0;
+    }
+
+    buffer[writer.length] = '\0';
+    rds->json.dirty = 0;
+    return writer.length;
+}
+
+size_t
+rdsparser_write_json(rdsparser_t *rds,
+                     char        *buffer,
+                     size_t       size,
+                     unsigned     flags)
+{
+    return rdsparser_json_write(rds, buffer, size, flags, RDSPARSER_JSON_DIRTY_ALL);
+}
+
+size_t
+rdsparser_write_json_delta(rdsparser_t *rds,
+                           char        *buffer,
+                           size_t       size,
+                           unsigned     flags)
+{
+    return rdsparser_json_write(rds, buffer, size, flags, rds->json.dirty);
+}
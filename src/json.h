@@ -0,0 +1,34 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_JSON_H
+#define RDSPARSER_JSON_H
+#include <librdsparser_private.h>
+
+/* Dirty bits: rdsparser_field_t followed by the fields without a TTL */
+#define RDSPARSER_JSON_DIRTY(field) (1u << (field))
+#define RDSPARSER_JSON_DIRTY_COUNTRY (1u << (RDSPARSER_FIELD_COUNT + 0))
+#define RDSPARSER_JSON_DIRTY_AF (1u << (RDSPARSER_FIELD_COUNT + 1))
+#define RDSPARSER_JSON_DIRTY_CT (1u << (RDSPARSER_FIELD_COUNT + 2))
+#define RDSPARSER_JSON_DIRTY_ALL UINT32_MAX
+
+void rdsparser_json_clear(rdsparser_json_t *json);
+void rdsparser_json_mark(rdsparser_json_t *json, uint32_t mask);
+#ifndef RDSPARSER_DISABLE_GROUP4
+void rdsparser_json_set_ct(rdsparser_json_t *json, const rdsparser_ct_t *ct);
+#endif
+
+#endif
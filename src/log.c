@@ -0,0 +1,318 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <librdsparser_private.h>
+#include "log.h"
+
+/*
+ * Binary group log
+ *
+ * Header (8 bytes):
+ *   "RDSL", version, reserved, sync interval (uint16 LE)
+ *
+ * Record (10+ bytes):
+ *   time delta in ms (unsigned LEB128 varint),
+ *   blocks A-D (big-endian uint16), packed error byte (A[7:6] B[5:4] C[3:2] D[1:0])
+ *
+ * Sync marker (14 bytes), written after the header and every sync interval:
+ *   0x80 0x00 (never produced by a minimal varint), "SYNC", absolute time in ms (uint64 LE)
+ */
+
+#define RDSPARSER_LOG_VERSION 1
+#define RDSPARSER_LOG_RECORD_SIZE 9
+#define RDSPARSER_LOG_SYNC_SIZE 14
+#define RDSPARSER_LOG_VARINT_MAX 10
+
+static const uint8_t rdsparser_log_magic[4] = { 'R', 'D', 'S', 'L' };
+static const uint8_t rdsparser_log_sync[6] = { 0x80, 0x00, 'S', 'Y', 'N', 'C' };
+
+static bool
+rdsparser_log_match(const uint8_t *buffer,
+                    const uint8_t *pattern,
+                    size_t         length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        if (buffer[i] != pattern[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool
+rdsparser_log_write_sync(rdsparser_log_writer_t *writer,
+                         uint64_t                time)
+{
+    uint8_t buffer[RDSPARSER_LOG_SYNC_SIZE];
+    for (uint8_t i = 0; i < sizeof(rdsparser_log_sync); i++)
+    {
+        buffer[i] = rdsparser_log_sync[i];
+    }
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        buffer[sizeof(rdsparser_log_sync) + i] = (uint8_t)(time >> (8 * i));
+    }
+
+    writer->time = time;
+    writer->records = 0;
+    return (fwrite(buffer, sizeof(buffer), 1, writer->file) == 1);
+}
+
+bool
+rdsparser_log_writer_init(rdsparser_log_writer_t *writer,
+                          FILE                   *file,
+                          uint16_t                sync_interval)
+{
+    const uint8_t header[RDSPARSER_LOG_HEADER_SIZE] =
+    {
+        rdsparser_log_magic[0],
+        rdsparser_log_magic[1],
+        rdsparser_log_magic[2],
+        rdsparser_log_magic[3],
+        RDSPARSER_LOG_VERSION,
+        0,
+        (uint8_t)sync_interval,
+        (uint8_t)(sync_interval >> 8)
+    };
+
+    writer->file = file;
+    writer->time = 0;
+    writer->sync_interval = sync_interval;
+    /* Force the sync marker before the first record */
+    writer->records = UINT16_MAX;
+
+    return (fwrite(header, sizeof(header), 1, file) == 1);
+}
+
+bool
+rdsparser_log_write(rdsparser_log_writer_t  *writer,
+                    uint64_t                 time,
+                    const rdsparser_data_t   data,
+                    const rdsparser_error_t  errors)
+{
+    if (writer->records == UINT16_MAX ||
+        (writer->sync_interval && writer->records >= writer->sync_interval) ||
+        time < writer->time)
+    {
+        /* Absolute time, also used when the clock goes backwards */
+        if (!rdsparser_log_write_sync(writer, time))
+        {
+            return false;
+        }
+    }
+
+    uint8_t buffer[RDSPARSER_LOG_VARINT_MAX + RDSPARSER_LOG_RECORD_SIZE];
+    uint64_t delta = time - writer->time;
+    size_t length = 0;
+
+    do
+    {
+        uint8_t byte = delta & 0x7F;
+        delta >>= 7;
+        buffer[length++] = (uint8_t)(delta ? (byte | 0x80) : byte);
+    } while (delta);
+
+    for (uint8_t block = 0; block < RDSPARSER_BLOCK_COUNT; block++)
+    {
+        buffer[length++] = (uint8_t)(data[block] >> 8);
+        buffer[length++] = (uint8_t)data[block];
+    }
+
+    buffer[length++] = (uint8_t)(((errors[RDSPARSER_BLOCK_A] & 3) << 6) |
+                                 ((errors[RDSPARSER_BLOCK_B] & 3) << 4) |
+                                 ((errors[RDSPARSER_BLOCK_C] & 3) << 2) |
+                                 (errors[RDSPARSER_BLOCK_D] & 3));
+
+    writer->time = time;
+    writer->records++;
+    return (fwrite(buffer, length, 1, writer->file) == 1);
+}
+
+bool
+rdsparser_log_detect(const uint8_t *buffer,
+                     size_t         length)
+{
+    return (length >= RDSPARSER_LOG_HEADER_SIZE &&
+            rdsparser_log_match(buffer, rdsparser_log_magic, sizeof(rdsparser_log_magic)));
+}
+
+bool
+rdsparser_log_reader_init(rdsparser_log_reader_t *reader,
+                          const uint8_t          *buffer,
+                          size_t                  length)
+{
+    if (!rdsparser_log_detect(buffer, length) ||
+        buffer[4] != RDSPARSER_LOG_VERSION)
+    {
+        return false;
+    }
+
+    reader->data = buffer;
+    reader->length = length;
+    reader->offset = RDSPARSER_LOG_HEADER_SIZE;
+    reader->time = 0;
+    reader->sync_interval = (uint16_t)(buffer[6] | (buffer[7] << 8));
+    reader->records = 0;
+    return true;
+}
+
+static bool
+rdsparser_log_reader_at_sync(const rdsparser_log_reader_t *reader,
+                             size_t                        offset)
+{
+    return (reader->length - offset >= RDSPARSER_LOG_SYNC_SIZE &&
+            rdsparser_log_match(reader->data + offset, rdsparser_log_sync, sizeof(rdsparser_log_sync)));
+}
+
+static bool
+rdsparser_log_reader_resync(rdsparser_log_reader_t *reader)
+{
+    for (size_t offset = reader->offset; offset < reader->length; offset++)
+    {
+        if (rdsparser_log_reader_at_sync(reader, offset))
+        {
+            reader->offset = offset;
+            return true;
+        }
+    }
+
+    reader->offset = reader->length;
+    return false;
+}
+
+bool
+rdsparser_log_read(rdsparser_log_reader_t *reader,
+                   rdsparser_data_t        data,
+                   rdsparser_error_t       errors,
+                   uint64_t               *time)
+{
+    while (reader->offset < reader->length)
+    {
+        if (rdsparser_log_reader_at_sync(reader, reader->offset))
+        {
+            const uint8_t *ptr = reader->data + reader->offset + sizeof(rdsparser_log_sync);
+            uint64_t value = 0;
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                value |= (uint64_t)ptr[i] << (8 * i);
+            }
+
+            reader->time = value;
+            reader->records = 0;
+            reader->offset += RDSPARSER_LOG_SYNC_SIZE;
+            continue;
+        }
+
+        if (reader->sync_interval &&
+            reader->records >= reader->sync_interval)
+        {
+            /* Missing sync marker, skip to the next one */
+            if (!rdsparser_log_reader_resync(reader))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        const uint8_t *ptr = reader->data + reader->offset;
+        const size_t available = reader->length - reader->offset;
+        uint64_t delta = 0;
+        size_t length = 0;
+        bool valid = false;
+
+        while (length < available &&
+               length < RDSPARSER_LOG_VARINT_MAX)
+        {
+            const uint8_t byte = ptr[length];
+            delta |= (uint64_t)(byte & 0x7F) << (7 * length);
+            length++;
+
+            if (!(byte & 0x80))
+            {
+                valid = true;
+                break;
+            }
+        }
+
+        if (!valid ||
+            available - length < RDSPARSER_LOG_RECORD_SIZE)
+        {
+            /* Truncated or corrupted record */
+            reader->offset++;
+            if (!rdsparser_log_reader_resync(reader))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        ptr += length;
+        for (uint8_t block = 0; block < RDSPARSER_BLOCK_COUNT; block++)
+        {
+            data[block] = (uint16_t)((ptr[2 * block] << 8) | ptr[2 * block + 1]);
+        }
+
+        const uint8_t packed = ptr[2 * RDSPARSER_BLOCK_COUNT];
+        errors[RDSPARSER_BLOCK_A] = (packed & 192) >> 6;
+        errors[RDSPARSER_BLOCK_B] = (packed & 48) >> 4;
+        errors[RDSPARSER_BLOCK_C] = (packed & 12) >> 2;
+        errors[RDSPARSER_BLOCK_D] = (packed & 3);
+
+        reader->time += delta;
+        reader->records++;
+        reader->offset += length + RDSPARSER_LOG_RECORD_SIZE;
+
+        if (time)
+        {
+            *time = reader->time;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+int64_t
+rdsparser_parse_log(rdsparser_t   *rds,
+                    const uint8_t *buffer,
+                    size_t         length)
+{
+    rdsparser_log_reader_t reader;
+    if (!rdsparser_log_reader_init(&reader, buffer, length))
+    {
+        return -1;
+    }
+
+    rdsparser_data_t data;
+    rdsparser_error_t errors;
+    uint64_t time;
+    int64_t count = 0;
+
+    /* The recorded time drives the TTL and AF ageing as in a live reception */
+    while (rdsparser_log_read(&reader, data, errors, &time))
+    {
+        rdsparser_parse_ts(rds, data, errors, time);
+        count++;
+    }
+
+    return count;
+}
@@ -0,0 +1,160 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <librdsparser_private.h>
+#include "oda.h"
+#include "rtplus.h"
+#include "tmc.h"
+#include "ert.h"
+
+#define RDSPARSER_ODA_HANDLER_NONE -1
+
+/* Group types with a fixed meaning that cannot carry an ODA:
+   0A, 0B, 1A, 1B, 2A, 2B, 3A, 4A, 10A, 14A, 14B, 15A, 15B */
+#define RDSPARSER_ODA_GROUP_MASK (~((uint32_t)0x3F | \
+                                   (1UL << RDSPARSER_ODA_INDEX(3, RDSPARSER_GROUP_FLAG_A)) | \
+                                   (1UL << RDSPARSER_ODA_INDEX(4, RDSPARSER_GROUP_FLAG_A)) | \
+                                   (1UL << RDSPARSER_ODA_INDEX(10, RDSPARSER_GROUP_FLAG_A)) | \
+                                   (1UL << RDSPARSER_ODA_INDEX(14, RDSPARSER_GROUP_FLAG_A)) | \
+                                   (1UL << RDSPARSER_ODA_INDEX(14, RDSPARSER_GROUP_FLAG_B)) | \
+                                   (1UL << RDSPARSER_ODA_INDEX(15, RDSPARSER_GROUP_FLAG_A)) | \
+                                   (1UL << RDSPARSER_ODA_INDEX(15, RDSPARSER_GROUP_FLAG_B))))
+
+static int8_t
+rdsparser_oda_find_handler(const rdsparser_oda_t *oda,
+                           uint16_t               aid)
+{
+    for (uint8_t i = 0; i < oda->handler_count; i++)
+    {
+        if (oda->handler[i].aid == aid)
+        {
+            return (int8_t)i;
+        }
+    }
+
+    return RDSPARSER_ODA_HANDLER_NONE;
+}
+
+void
+rdsparser_oda_init(rdsparser_oda_t *oda)
+{
+    oda->handler_count = 0;
+    rdsparser_oda_clear(oda);
+}
+
+void
+rdsparser_oda_clear(rdsparser_oda_t *oda)
+{
+    for (uint8_t i = 0; i < RDSPARSER_ODA_GROUP_COUNT; i++)
+    {
+        oda->group[i].aid = RDSPARSER_ODA_AID_NONE;
+        oda->group[i].handler = RDSPARSER_ODA_HANDLER_NONE;
+    }
+}
+
+bool
+rdsparser_oda_announce(rdsparser_oda_t *oda,
+                       uint8_t          index,
+                       uint16_t         aid)
+{
+    if (index >= RDSPARSER_ODA_GROUP_COUNT ||
+        !(RDSPARSER_ODA_GROUP_MASK & (1UL << index)) ||
+        oda->group[index].aid == aid)
+    {
+        return false;
+    }
+
+    /* The handler is resolved once here, so that
+       each ODA group is dispatched with a direct lookup */
+    oda->group[index].aid = aid;
+    oda->group[index].handler = rdsparser_oda_find_handler(oda, aid);
+    return true;
+}
+
+bool
+rdsparser_oda_register(rdsparser_oda_t          *oda,
+                       uint16_t                  aid,
+                       rdsparser_oda_callback_t  callback)
+{
+    int8_t handler = rdsparser_oda_find_handler(oda, aid);
+
+    if (handler == RDSPARSER_ODA_HANDLER_NONE)
+    {
+        if (oda->handler_count == RDSPARSER_ODA_HANDLER_COUNT)
+        {
+            return false;
+        }
+
+        handler = (int8_t)oda->handler_count++;
+        oda->handler[handler].aid = aid;
+    }
+
+    oda->handler[handler].callback = callback;
+
+    for (uint8_t i = 0; i < RDSPARSER_ODA_GROUP_COUNT; i++)
+    {
+        if (oda->group[i].aid == aid)
+        {
+            oda->group[i].handler = handler;
+        }
+    }
+
+    return true;
+}
+
+bool
+rdsparser_oda_process(rdsparser_t             *rds,
+                      uint8_t                  index,
+                      const rdsparser_data_t   data,
+                      const rdsparser_error_t  errors)
+{
+    const rdsparser_oda_group_t *group = &rds->oda.group[index];
+
+    if (group->aid == RDSPARSER_ODA_AID_NONE)
+    {
+        return false;
+    }
+
+    switch (group->aid)
+    {
+        case RDSPARSER_RTPLUS_AID:
+            rdsparser_rtplus_parse(rds, data, errors);
+            break;
+
+        case RDSPARSER_TMC_AID:
+        case RDSPARSER_TMC_AID_ALT:
+            if (index == RDSPARSER_ODA_INDEX(8, RDSPARSER_GROUP_FLAG_A))
+            {
+                rdsparser_tmc_parse(rds, data, errors);
+            }
+            break;
+
+        case RDSPARSER_ERT_AID:
+            rdsparser_ert_parse(rds, data, errors, index & 1);
+            break;
+    }
+
+    if (group->handler != RDSPARSER_ODA_HANDLER_NONE)
+    {
+        const rdsparser_oda_handler_t *handler = &rds->oda.handler[group->handler];
+        if (handler->callback)
+        {
+            handler->callback(rds, group->aid, data, errors, rds->user_data);
+        }
+    }
+
+    return true;
+}
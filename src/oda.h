@@ -0,0 +1,29 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_ODA_H
+#define RDSPARSER_ODA_H
+#include <librdsparser_private.h>
+
+#define RDSPARSER_ODA_INDEX(group, flag) (((group) << 1) | (flag))
+
+void rdsparser_oda_init(rdsparser_oda_t *oda);
+void rdsparser_oda_clear(rdsparser_oda_t *oda);
+bool rdsparser_oda_announce(rdsparser_oda_t *oda, uint8_t index, uint16_t aid);
+bool rdsparser_oda_register(rdsparser_oda_t *oda, uint16_t aid, rdsparser_oda_callback_t callback);
+bool rdsparser_oda_process(rdsparser_t *rds, uint8_t index, const rdsparser_data_t data, const rdsparser_error_t errors);
+
+#endif
\ No newline at end of file
@@ -19,11 +19,25 @@
 #include "af.h"
 #include "group.h"
 #include "group0.h"
+#ifndef RDSPARSER_DISABLE_GROUP1
 #include "group1.h"
+#endif
 #include "group2.h"
+#include "group3.h"
+#ifndef RDSPARSER_DISABLE_GROUP4
 #include "group4.h"
+#endif
+#ifndef RDSPARSER_DISABLE_GROUP10
 #include "group10.h"
+#endif
+#include "group14.h"
+#include "group15.h"
 #include "string.h"
+#include "oda.h"
+#include "tmc.h"
+#include "ttl.h"
+#include "event.h"
+#include "json.h"
 
 static inline uint8_t
 rdsparser_parser_get_group(const rdsparser_data_t data)
@@ -42,31 +56,65 @@ rdsparser_parser_process(rdsparser_t             *rds,
                          const rdsparser_data_t   data,
                          const rdsparser_error_t  errors)
 {
+    rds->groups++;
     rdsparser_group_parse(rds, data, errors);
 
     rdsparser_group_flag_t flag = rdsparser_parser_get_flag(data);
     uint8_t group = rdsparser_parser_get_group(data);
+
+    if (errors[RDSPARSER_BLOCK_B] == 0 &&
+        rdsparser_oda_process(rds, RDSPARSER_ODA_INDEX(group, flag), data, errors))
+    {
+        return;
+    }
+
     switch (group)
     {
         case 0:
             rdsparser_group0_parse(rds, data, errors, flag);
             break;
 
+#ifndef RDSPARSER_DISABLE_GROUP1
         case 1:
             rdsparser_group1_parse(rds, data, errors, flag);
             break;
+#endif
 
         case 2:
             rdsparser_group2_parse(rds, data, errors, flag);
             break;
 
+        case 3:
+            rdsparser_group3_parse(rds, data, errors, flag);
+            break;
+
+#ifndef RDSPARSER_DISABLE_GROUP4
         case 4:
             rdsparser_group4_parse(rds, data, errors, flag);
             break;
+#endif
+
+        case 8:
+            if (flag == RDSPARSER_GROUP_FLAG_A)
+            {
+                /* TMC without 3A announcement */
+                rdsparser_tmc_parse(rds, data, errors);
+            }
+            break;
 
+#ifndef RDSPARSER_DISABLE_GROUP10
         case 10:
             rdsparser_group10_parse(rds, data, errors, flag);
             break;
+#endif
+
+        case 14:
+            rdsparser_group14_parse(rds, data, errors, flag);
+            break;
+
+        case 15:
+            rdsparser_group15_parse(rds, data, errors, flag);
+            break;
     }
 }
 
@@ -82,17 +130,32 @@ rdsparser_parser_update_string(rdsparser_t             *context,
     if (errors[RDSPARSER_BLOCK_B] <= context->correction[text][RDSPARSER_BLOCK_TYPE_INFO] &&
         errors[data_block] <= context->correction[text][RDSPARSER_BLOCK_TYPE_DATA])
     {
+        /* EON uses the PS settings for its own strings */
+        const bool own = (text != RDSPARSER_TEXT_PS ||
+                          string == context->ps);
+        if (own)
+        {
+            rdsparser_ttl_touch(&context->ttl, RDSPARSER_FIELD_PS + text, context->time);
+        }
+
         char block[2];
         block[0] = data[data_block] >> 8;
         block[1] = (uint8_t)data[data_block];
 
-        return rdsparser_string_update(string,
-                                       block,
-                                       errors[RDSPARSER_BLOCK_B],
-                                       errors[data_block],
-                                       position,
-                                       context->progressive[text],
-                                       true);
+        const bool changed = rdsparser_string_update(string,
+                                                     block,
+                                                     errors[RDSPARSER_BLOCK_B],
+                                                     errors[data_block],
+                                                     position,
+                                                     context->progressive[text],
+                                                     true);
+        if (changed && own)
+        {
+            rdsparser_event_range(&context->events, text, position);
+            rdsparser_json_mark(&context->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PS + text));
+        }
+
+        return changed;
     }
 
     return false;
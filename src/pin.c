@@ -0,0 +1,37 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <librdsparser.h>
+
+uint8_t
+rdsparser_pin_get_day(rdsparser_pin_t pin)
+{
+    return (pin == RDSPARSER_PIN_UNKNOWN) ? 0 : (uint8_t)((pin >> 11) & 0x1F);
+}
+
+uint8_t
+rdsparser_pin_get_hour(rdsparser_pin_t pin)
+{
+    return (pin == RDSPARSER_PIN_UNKNOWN) ? 0 : (uint8_t)((pin >> 6) & 0x1F);
+}
+
+uint8_t
+rdsparser_pin_get_minute(rdsparser_pin_t pin)
+{
+    return (pin == RDSPARSER_PIN_UNKNOWN) ? 0 : (uint8_t)(pin & 0x3F);
+}
@@ -19,9 +19,25 @@
 #include <librdsparser_private.h>
 #include "buffer.h"
 #include "af.h"
+#ifndef RDSPARSER_DISABLE_GROUP4
+#include "ct.h"
+#endif
 #include "parser.h"
+#include "group2.h"
 #include "utils.h"
 #include "string.h"
+#include "eon.h"
+#include "rtplus.h"
+#include "oda.h"
+#include "tmc.h"
+#include "ttl.h"
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+#include "station.h"
+#endif
+#include "event.h"
+#include "json.h"
+
+static const rdsparser_handlers_t rdsparser_handlers_none;
 
 #ifndef RDSPARSER_DISABLE_HEAP
 rdsparser_t*
@@ -41,6 +57,7 @@ rdsparser_free(rdsparser_t *rds)
 {
     if (rds)
     {
+        rdsparser_deinit(rds);
         free(rds);
     }
 }
@@ -50,22 +67,171 @@ void
 rdsparser_init(rdsparser_t *rds)
 {
     memset(rds, 0, sizeof(rdsparser_t));
+    rds->handlers = &rdsparser_handlers_none;
     rdsparser_buffer_init(&rds->buffer);
-    rdsparser_string_init(rds->ps, RDSPARSER_PS_LENGTH);
-    rdsparser_string_init(rds->rt[0], RDSPARSER_RT_LENGTH);
-    rdsparser_string_init(rds->rt[1], RDSPARSER_RT_LENGTH);
-    rdsparser_string_init(rds->ptyn, RDSPARSER_PTYN_LENGTH);
+    rdsparser_string_init(rds->ps, RDSPARSER_PS_LENGTH, RDSPARSER_STRING_ENCODING_BASIC);
+    for (uint8_t i = 0; i < RDSPARSER_RT_BUFFER_COUNT; i++)
+    {
+        rdsparser_string_init(rds->rt[i], RDSPARSER_RT_LENGTH, RDSPARSER_STRING_ENCODING_BASIC);
+    }
+    rdsparser_string_init(rds->ptyn, RDSPARSER_PTYN_LENGTH, RDSPARSER_STRING_ENCODING_BASIC);
+    rdsparser_eon_table_init(&rds->eon);
+    rdsparser_oda_init(&rds->oda);
+    rds->tmc_window = RDSPARSER_TMC_WINDOW;
     rdsparser_clear(rds);
 }
 
+void
+rdsparser_deinit(rdsparser_t *rds)
+{
+    /* Release the buffers of the optional features, which are disabled */
+    rdsparser_set_text_enabled(rds, RDSPARSER_TEXT_LPS, false);
+    rdsparser_set_text_enabled(rds, RDSPARSER_TEXT_ERT, false);
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    rdsparser_set_station_cache(rds, RDSPARSER_STATION_CACHE_OFF);
+#endif
+    rdsparser_set_events(rds, false);
+}
+
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+static uint32_t
+rdsparser_station_frequency(const rdsparser_t *rds)
+{
+    return (rds->station_cache == RDSPARSER_STATION_CACHE_PI_FREQUENCY) ? rds->frequency : 0;
+}
+
+static void
+rdsparser_station_leave(rdsparser_t    *rds,
+                        rdsparser_pi_t  pi)
+{
+    if (rds->station_cache != RDSPARSER_STATION_CACHE_OFF &&
+        pi != RDSPARSER_PI_UNKNOWN)
+    {
+        rdsparser_station_t *station = rdsparser_station_table_insert(rds->stations, pi, rdsparser_station_frequency(rds));
+        rdsparser_station_save(station, rds);
+    }
+}
+
+static void
+rdsparser_station_enter(rdsparser_t    *rds,
+                        rdsparser_pi_t  previous_pi,
+                        rdsparser_pi_t  pi)
+{
+    if (rds->station_cache == RDSPARSER_STATION_CACHE_OFF)
+    {
+        return;
+    }
+
+    const rdsparser_station_t *station = rdsparser_station_table_lookup(rds->stations, pi, rdsparser_station_frequency(rds));
+    if (station == NULL &&
+        previous_pi == RDSPARSER_PI_UNKNOWN)
+    {
+        /* Nothing to restore and no other station to forget */
+        return;
+    }
+
+    const rdsparser_af_t previous = *rdsparser_buffer_get_af(&rds->buffer);
+    const bool ps = rdsparser_string_get_available(rds->ps);
+    const bool ptyn = rdsparser_string_get_available(rds->ptyn);
+    bool rt[RDSPARSER_RT_BUFFER_COUNT];
+    for (uint8_t i = 0; i < RDSPARSER_RT_BUFFER_COUNT; i++)
+    {
+        rt[i] = rdsparser_string_get_available(rds->rt[i]);
+        rdsparser_rt_state_clear(&rds->rt_state[i]);
+    }
+
+    if (station)
+    {
+        rdsparser_station_restore(station, rds);
+        rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_PS, rds->time);
+        rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_RT, rds->time);
+        rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_PTYN, rds->time);
+    }
+    else
+    {
+        /* Unknown station, the data of the previous one (already saved) does not belong to it */
+        rdsparser_station_reset(rds);
+    }
+
+    rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PS) |
+                                    RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_RT) |
+                                    RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PTYN) |
+                                    RDSPARSER_JSON_DIRTY_AF);
+
+    if (rds->handlers->af)
+    {
+        const rdsparser_af_t *af = rdsparser_buffer_get_af(&rds->buffer);
+        for (uint32_t frequency = rdsparser_af_next(af, 0);
+             frequency;
+             frequency = rdsparser_af_next(af, frequency))
+        {
+            if (!rdsparser_af_get(&previous, rdsparser_af_get_value(frequency)))
+            {
+                rds->handlers->af(rds, frequency, rds->user_data);
+            }
+        }
+    }
+
+    if (rds->handlers->ps &&
+        (ps || rdsparser_string_get_available(rds->ps)))
+    {
+        rds->handlers->ps(rds, rds->user_data);
+    }
+
+    for (rdsparser_rt_flag_t flag = 0; flag < RDSPARSER_RT_BUFFER_COUNT; flag++)
+    {
+        if (rds->handlers->rt &&
+            (rt[flag] || rdsparser_string_get_available(rds->rt[flag])))
+        {
+            rds->handlers->rt(rds, flag, rds->user_data);
+        }
+    }
+
+    if (rds->handlers->ptyn &&
+        (ptyn || rdsparser_string_get_available(rds->ptyn)))
+    {
+        rds->handlers->ptyn(rds, rds->user_data);
+    }
+}
+#endif
+
 void
 rdsparser_clear(rdsparser_t *rds)
 {
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    /* Keep the state of the station for the next reception */
+    rdsparser_station_leave(rds, rdsparser_buffer_get_pi(&rds->buffer));
+#endif
+
     rdsparser_buffer_clear(&rds->buffer);
     rdsparser_string_clear(rds->ps);
-    rdsparser_string_clear(rds->rt[0]);
-    rdsparser_string_clear(rds->rt[1]);
+    for (uint8_t i = 0; i < RDSPARSER_RT_BUFFER_COUNT; i++)
+    {
+        rdsparser_string_clear(rds->rt[i]);
+        rdsparser_rt_state_clear(&rds->rt_state[i]);
+    }
     rdsparser_string_clear(rds->ptyn);
+    if (rds->lps)
+    {
+        rdsparser_string_clear(rds->lps);
+    }
+    if (rds->ert)
+    {
+        rdsparser_string_clear(rds->ert);
+    }
+#ifndef RDSPARSER_DISABLE_AF
+    rdsparser_af_table_clear(&rds->af_table);
+#endif
+    rdsparser_eon_table_clear(&rds->eon);
+    rdsparser_rtplus_clear(&rds->rtplus);
+    rdsparser_oda_clear(&rds->oda);
+    rdsparser_tmc_clear(&rds->tmc);
+#ifndef RDSPARSER_DISABLE_GROUP4
+    rdsparser_ct_filter_clear(&rds->ct_filter);
+#endif
+    rdsparser_ttl_clear(&rds->ttl);
+    rdsparser_event_clear_range(&rds->events);
+    rdsparser_json_clear(&rds->json);
     rds->last_rt_flag = -1;
 }
 
@@ -77,6 +243,17 @@ rdsparser_parse(rdsparser_t       *rds,
     rdsparser_parser_process(rds, data, errors);
 }
 
+void
+rdsparser_parse_ts(rdsparser_t       *rds,
+                   rdsparser_data_t   data,
+                   rdsparser_error_t  errors,
+                   uint64_t           now)
+{
+    rds->time = now;
+    rdsparser_parser_process(rds, data, errors);
+    rdsparser_expire(rds, now);
+}
+
 void
 rdsparser_set_extended_check(rdsparser_t *rds,
                              bool         value)
@@ -107,6 +284,58 @@ rdsparser_parse_string(rdsparser_t *rds,
     return false;
 }
 
+bool
+rdsparser_read_group(const char        **input,
+                     const char         *end,
+                     rdsparser_data_t    data,
+                     rdsparser_error_t   errors)
+{
+    const char *line = *input;
+
+    while (line < end)
+    {
+        const char *line_end = memchr(line, '\n', (size_t)(end - line));
+        const char *next = line_end ? line_end + 1 : end;
+        size_t line_length = (size_t)((line_end ? line_end : end) - line);
+
+        if (line_length &&
+            line[line_length - 1] == '\r')
+        {
+            line_length--;
+        }
+
+        if (rdsparser_utils_convert_length(line, line_length, data, errors))
+        {
+            *input = next;
+            return true;
+        }
+
+        line = next;
+    }
+
+    *input = line;
+    return false;
+}
+
+size_t
+rdsparser_parse_buffer(rdsparser_t *rds,
+                       const char  *buffer,
+                       size_t       length)
+{
+    const char *end = buffer + length;
+    rdsparser_data_t data;
+    rdsparser_error_t errors;
+    size_t count = 0;
+
+    while (rdsparser_read_group(&buffer, end, data, errors))
+    {
+        rdsparser_parser_process(rds, data, errors);
+        count++;
+    }
+
+    return count;
+}
+
 void
 rdsparser_set_text_correction(rdsparser_t             *rds,
                               rdsparser_text_t         text,
@@ -140,16 +369,466 @@ rdsparser_get_text_progressive(const rdsparser_t *rds,
     return rds->progressive[text];
 }
 
+bool
+rdsparser_set_text_enabled(rdsparser_t      *rds,
+                           rdsparser_text_t  text,
+                           bool              state)
+{
+    rdsparser_string_t **string;
+    uint8_t length;
+
+    switch (text)
+    {
+        case RDSPARSER_TEXT_LPS:
+            string = &rds->lps;
+            length = RDSPARSER_LPS_LENGTH;
+            break;
+
+        case RDSPARSER_TEXT_ERT:
+            string = &rds->ert;
+            length = RDSPARSER_ERT_LENGTH;
+            break;
+
+        default:
+            /* Basic texts are always enabled */
+            return state;
+    }
+
+    if (state == (*string != NULL))
+    {
+        return true;
+    }
+
+    if (!state)
+    {
+#ifndef RDSPARSER_DISABLE_HEAP
+        free(*string);
+#endif
+        *string = NULL;
+        return true;
+    }
+
+#ifndef RDSPARSER_DISABLE_HEAP
+    *string = malloc(RDSPARSER_STRING_SIZE(length) * sizeof(rdsparser_string_t));
+    if (*string == NULL)
+    {
+        return false;
+    }
+#else
+    *string = (text == RDSPARSER_TEXT_LPS ? rds->lps_buffer : rds->ert_buffer);
+#endif
+
+    rdsparser_string_init(*string, length, RDSPARSER_STRING_ENCODING_UTF8);
+    rdsparser_string_clear(*string);
+    return true;
+}
+
+bool
+rdsparser_get_text_enabled(const rdsparser_t *rds,
+                           rdsparser_text_t   text)
+{
+    switch (text)
+    {
+        case RDSPARSER_TEXT_LPS:
+            return (rds->lps != NULL);
+
+        case RDSPARSER_TEXT_ERT:
+            return (rds->ert != NULL);
+
+        default:
+            return (text < RDSPARSER_TEXT_COUNT);
+    }
+}
+
+void
+rdsparser_set_time(rdsparser_t *rds,
+                   uint64_t     now)
+{
+    rds->time = now;
+}
+
+uint64_t
+rdsparser_get_time(const rdsparser_t *rds)
+{
+    return rds->time;
+}
+
+void
+rdsparser_set_ttl(rdsparser_t       *rds,
+                  rdsparser_field_t  field,
+                  uint32_t           ttl)
+{
+    if (field < RDSPARSER_FIELD_COUNT)
+    {
+        rdsparser_ttl_set(&rds->ttl, field, ttl);
+    }
+}
+
+uint32_t
+rdsparser_get_ttl(const rdsparser_t *rds,
+                  rdsparser_field_t  field)
+{
+    return (field < RDSPARSER_FIELD_COUNT) ? rds->ttl.ttl[field] : 0;
+}
+
+uint64_t
+rdsparser_get_last_seen(const rdsparser_t *rds,
+                        rdsparser_field_t  field)
+{
+    return (field < RDSPARSER_FIELD_COUNT) ? rds->ttl.last_seen[field] : 0;
+}
+
+static bool
+rdsparser_expire_string(rdsparser_t        *rds,
+                        rdsparser_string_t *string,
+                        void              (*callback)(rdsparser_t*, void*))
+{
+    if (string &&
+        rdsparser_string_get_available(string))
+    {
+        rdsparser_string_clear(string);
+        if (callback)
+        {
+            callback(rds, rds->user_data);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+static void
+rdsparser_expire_field(rdsparser_t       *rds,
+                       rdsparser_field_t  field)
+{
+    void (*callback)(rdsparser_t*, void*) = NULL;
+    bool changed = false;
+
+    switch (field)
+    {
+        case RDSPARSER_FIELD_PI:
+            changed = rdsparser_buffer_reset_pi(&rds->buffer);
+            callback = rds->handlers->pi;
+            break;
+
+        case RDSPARSER_FIELD_PTY:
+            changed = rdsparser_buffer_reset_pty(&rds->buffer);
+            callback = rds->handlers->pty;
+            break;
+
+        case RDSPARSER_FIELD_TP:
+            changed = rdsparser_buffer_reset_tp(&rds->buffer);
+            callback = rds->handlers->tp;
+            break;
+
+        case RDSPARSER_FIELD_TA:
+            changed = rdsparser_buffer_reset_ta(&rds->buffer);
+            callback = rds->handlers->ta;
+            break;
+
+        case RDSPARSER_FIELD_MS:
+            changed = rdsparser_buffer_reset_ms(&rds->buffer);
+            callback = rds->handlers->ms;
+            break;
+
+        case RDSPARSER_FIELD_ECC:
+            /* Country is derived from the ECC */
+            if (rdsparser_buffer_reset_country(&rds->buffer))
+            {
+                rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY_COUNTRY);
+                if (rds->handlers->country)
+                {
+                    rds->handlers->country(rds, rds->user_data);
+                }
+            }
+            changed = rdsparser_buffer_reset_ecc(&rds->buffer);
+            callback = rds->handlers->ecc;
+            break;
+
+        case RDSPARSER_FIELD_PIN:
+            changed = rdsparser_buffer_reset_pin(&rds->buffer);
+            callback = rds->handlers->pin;
+            break;
+
+        case RDSPARSER_FIELD_PS:
+            changed = rdsparser_expire_string(rds, rds->ps, rds->handlers->ps);
+            break;
+
+        case RDSPARSER_FIELD_RT:
+            for (rdsparser_rt_flag_t flag = 0; flag < RDSPARSER_RT_BUFFER_COUNT; flag++)
+            {
+                rdsparser_rt_state_clear(&rds->rt_state[flag]);
+                if (rdsparser_string_get_available(rds->rt[flag]))
+                {
+                    rdsparser_string_clear(rds->rt[flag]);
+                    changed = true;
+                    if (rds->handlers->rt)
+                    {
+                        rds->handlers->rt(rds, flag, rds->user_data);
+                    }
+                }
+            }
+            break;
+
+        case RDSPARSER_FIELD_PTYN:
+            changed = rdsparser_expire_string(rds, rds->ptyn, rds->handlers->ptyn);
+            break;
+
+        case RDSPARSER_FIELD_LPS:
+            changed = rdsparser_expire_string(rds, rds->lps, rds->handlers->lps);
+            break;
+
+        case RDSPARSER_FIELD_ERT:
+            changed = rdsparser_expire_string(rds, rds->ert, rds->handlers->ert);
+            break;
+    }
+
+    if (changed)
+    {
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(field));
+        if (callback)
+        {
+            callback(rds, rds->user_data);
+        }
+    }
+}
+
+void
+rdsparser_expire(rdsparser_t *rds,
+                 uint64_t     now)
+{
+    uint32_t expired = rdsparser_ttl_check(&rds->ttl, now);
+
+    for (rdsparser_field_t field = 0; expired; field++, expired >>= 1)
+    {
+        if (expired & 1)
+        {
+            rdsparser_expire_field(rds, field);
+        }
+    }
+}
+
+#ifndef RDSPARSER_DISABLE_AF
+void
+rdsparser_set_af_ageing(rdsparser_t *rds,
+                        bool         state)
+{
+    if (state && !rds->af_ageing)
+    {
+        /* Start ageing already known frequencies from now */
+        const rdsparser_af_t *af = rdsparser_buffer_get_af(&rds->buffer);
+        rdsparser_af_table_clear(&rds->af_table);
+
+        for (uint32_t frequency = rdsparser_af_next(af, 0);
+             frequency;
+             frequency = rdsparser_af_next(af, frequency))
+        {
+            rdsparser_af_table_hit(&rds->af_table, rdsparser_af_get_value(frequency), rds->time);
+        }
+    }
+
+    rds->af_ageing = state;
+}
+
+bool
+rdsparser_get_af_ageing(const rdsparser_t *rds)
+{
+    return rds->af_ageing;
+}
+#endif
+
+#ifndef RDSPARSER_DISABLE_GROUP4
+void
+rdsparser_set_ct_filter(rdsparser_t *rds,
+                        bool         state)
+{
+    if (state != rds->ct_filter_enabled)
+    {
+        rdsparser_ct_filter_clear(&rds->ct_filter);
+    }
+
+    rds->ct_filter_enabled = state;
+}
+
+bool
+rdsparser_get_ct_filter(const rdsparser_t *rds)
+{
+    return rds->ct_filter_enabled;
+}
+#endif
+
+void
+rdsparser_set_rt_complete_threshold(rdsparser_t              *rds,
+                                    rdsparser_string_error_t  error)
+{
+    rds->rt_complete_threshold = error;
+}
+
+rdsparser_string_error_t
+rdsparser_get_rt_complete_threshold(const rdsparser_t *rds)
+{
+    return rds->rt_complete_threshold;
+}
+
+void
+rdsparser_set_tmc_window(rdsparser_t *rds,
+                         uint32_t     groups)
+{
+    rds->tmc_window = groups;
+}
+
+uint32_t
+rdsparser_get_tmc_window(const rdsparser_t *rds)
+{
+    return rds->tmc_window;
+}
+
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+bool
+rdsparser_set_station_cache(rdsparser_t               *rds,
+                            rdsparser_station_cache_t  mode)
+{
+    if (mode == RDSPARSER_STATION_CACHE_OFF)
+    {
+#ifndef RDSPARSER_DISABLE_HEAP
+        free(rds->stations);
+#endif
+        rds->stations = NULL;
+        rds->station_cache = mode;
+        return true;
+    }
+
+    if (rds->stations == NULL)
+    {
+#ifndef RDSPARSER_DISABLE_HEAP
+        rds->stations = malloc(sizeof(rdsparser_station_table_t));
+        if (rds->stations == NULL)
+        {
+            return false;
+        }
+#else
+        rds->stations = &rds->stations_buffer;
+#endif
+        rdsparser_station_table_init(rds->stations);
+    }
+    else if (mode != rds->station_cache)
+    {
+        /* Entries are keyed differently in each mode */
+        rdsparser_station_table_clear(rds->stations);
+    }
+
+    rds->station_cache = mode;
+    return true;
+}
+
+rdsparser_station_cache_t
+rdsparser_get_station_cache(const rdsparser_t *rds)
+{
+    return rds->station_cache;
+}
+
+void
+rdsparser_set_frequency(rdsparser_t *rds,
+                        uint32_t     frequency)
+{
+    rds->frequency = frequency;
+}
+
+uint32_t
+rdsparser_get_frequency(const rdsparser_t *rds)
+{
+    return rds->frequency;
+}
+
+uint8_t
+rdsparser_get_station_cache_count(const rdsparser_t *rds)
+{
+    return rds->stations ? rds->stations->count : 0;
+}
+
+void
+rdsparser_clear_station_cache(rdsparser_t *rds)
+{
+    if (rds->stations)
+    {
+        rdsparser_station_table_clear(rds->stations);
+    }
+}
+#endif
+
+#ifndef RDSPARSER_DISABLE_AF
+void
+rdsparser_af_expire(rdsparser_t *rds,
+                    uint64_t     now,
+                    uint32_t     max_age)
+{
+    if (!rds->af_ageing)
+    {
+        return;
+    }
+
+    const rdsparser_af_t *af = rdsparser_buffer_get_af(&rds->buffer);
+    uint32_t frequency = rdsparser_af_next(af, 0);
+
+    while (frequency)
+    {
+        const uint32_t next = rdsparser_af_next(af, frequency);
+        const uint8_t value = rdsparser_af_get_value(frequency);
+
+        if (rdsparser_af_table_expired(&rds->af_table, value, now, max_age) &&
+            rdsparser_buffer_remove_af(&rds->buffer, value))
+        {
+            rds->af_table.hits[value] = 0;
+            rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY_AF);
+            if (rds->handlers->af_expire)
+            {
+                rds->handlers->af_expire(rds, frequency, rds->user_data);
+            }
+        }
+
+        frequency = next;
+    }
+}
+
+uint16_t
+rdsparser_get_af_hits(const rdsparser_t *rds,
+                      uint32_t           frequency)
+{
+    return rds->af_table.hits[rdsparser_af_get_value(frequency)];
+}
+
+uint64_t
+rdsparser_get_af_last_seen(const rdsparser_t *rds,
+                           uint32_t           frequency)
+{
+    return rds->af_table.last_seen[rdsparser_af_get_value(frequency)];
+}
+#endif
+
 void
 rdsparser_set_pi(rdsparser_t    *rds,
                  rdsparser_pi_t  pi)
 {
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    const rdsparser_pi_t previous = rdsparser_buffer_get_pi(&rds->buffer);
+#endif
+    rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_PI, rds->time);
+
     if (rdsparser_buffer_update_pi(&rds->buffer, pi))
     {
-        if (rds->callback_pi)
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PI));
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+        rdsparser_station_leave(rds, previous);
+#endif
+
+        if (rds->handlers->pi)
         {
-            rds->callback_pi(rds, rds->user_data);
+            rds->handlers->pi(rds, rds->user_data);
         }
+
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+        rdsparser_station_enter(rds, previous, pi);
+#endif
     }
 }
 
@@ -163,11 +842,14 @@ void
 rdsparser_set_pty(rdsparser_t     *rds,
                   rdsparser_pty_t  pty)
 {
+    rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_PTY, rds->time);
+
     if (rdsparser_buffer_update_pty(&rds->buffer, pty))
     {
-        if (rds->callback_pty)
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PTY));
+        if (rds->handlers->pty)
         {
-            rds->callback_pty(rds, rds->user_data);
+            rds->handlers->pty(rds, rds->user_data);
         }
     }
 }
@@ -182,11 +864,14 @@ void
 rdsparser_set_tp(rdsparser_t    *rds,
                  rdsparser_tp_t  tp)
 {
+    rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_TP, rds->time);
+
     if (rdsparser_buffer_update_tp(&rds->buffer, tp))
     {
-        if (rds->callback_tp)
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_TP));
+        if (rds->handlers->tp)
         {
-            rds->callback_tp(rds, rds->user_data);
+            rds->handlers->tp(rds, rds->user_data);
         }
     }
 }
@@ -201,11 +886,14 @@ void
 rdsparser_set_ta(rdsparser_t     *rds,
                   rdsparser_ta_t  ta)
 {
+    rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_TA, rds->time);
+
     if (rdsparser_buffer_update_ta(&rds->buffer, ta))
     {
-        if (rds->callback_ta)
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_TA));
+        if (rds->handlers->ta)
         {
-            rds->callback_ta(rds, rds->user_data);
+            rds->handlers->ta(rds, rds->user_data);
         }
     }
 }
@@ -220,11 +908,14 @@ void
 rdsparser_set_ms(rdsparser_t    *rds,
                  rdsparser_ms_t  ms)
 {
+    rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_MS, rds->time);
+
     if (rdsparser_buffer_update_ms(&rds->buffer, ms))
     {
-        if (rds->callback_ms)
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_MS));
+        if (rds->handlers->ms)
         {
-            rds->callback_ms(rds, rds->user_data);
+            rds->handlers->ms(rds, rds->user_data);
         }
     }
 }
@@ -239,11 +930,14 @@ void
 rdsparser_set_ecc(rdsparser_t     *rds,
                   rdsparser_ecc_t  ecc)
 {
+    rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_ECC, rds->time);
+
     if (rdsparser_buffer_update_ecc(&rds->buffer, ecc))
     {
-        if (rds->callback_ecc)
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_ECC));
+        if (rds->handlers->ecc)
         {
-            rds->callback_ecc(rds, rds->user_data);
+            rds->handlers->ecc(rds, rds->user_data);
         }
     }
 }
@@ -260,9 +954,10 @@ rdsparser_set_country(rdsparser_t         *rds,
 {
     if (rdsparser_buffer_update_country(&rds->buffer, country))
     {
-        if (rds->callback_country)
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY_COUNTRY);
+        if (rds->handlers->country)
         {
-            rds->callback_country(rds, rds->user_data);
+            rds->handlers->country(rds, rds->user_data);
         }
     }
 }
@@ -273,16 +968,92 @@ rdsparser_get_country(const rdsparser_t *rds)
     return rdsparser_buffer_get_country(&rds->buffer);
 }
 
+void
+rdsparser_set_pin(rdsparser_t     *rds,
+                  rdsparser_pin_t  pin)
+{
+    rdsparser_ttl_touch(&rds->ttl, RDSPARSER_FIELD_PIN, rds->time);
+
+    if (rdsparser_buffer_update_pin(&rds->buffer, pin))
+    {
+        if (rds->handlers->pin)
+        {
+            rds->handlers->pin(rds, rds->user_data);
+        }
+    }
+}
+
+rdsparser_pin_t
+rdsparser_get_pin(const rdsparser_t *rds)
+{
+    return rdsparser_buffer_get_pin(&rds->buffer);
+}
+
+void
+rdsparser_set_la(rdsparser_t    *rds,
+                 rdsparser_la_t  la)
+{
+    if (rdsparser_buffer_update_la(&rds->buffer, la))
+    {
+        if (rds->handlers->la)
+        {
+            rds->handlers->la(rds, rds->user_data);
+        }
+    }
+}
+
+rdsparser_la_t
+rdsparser_get_la(const rdsparser_t *rds)
+{
+    return rdsparser_buffer_get_la(&rds->buffer);
+}
+
+void
+rdsparser_set_slc(rdsparser_t             *rds,
+                  rdsparser_slc_variant_t  variant,
+                  rdsparser_slc_t          value)
+{
+    if (rdsparser_buffer_update_slc(&rds->buffer, variant, value))
+    {
+        if (rds->handlers->slc)
+        {
+            rds->handlers->slc(rds, variant, rds->user_data);
+        }
+    }
+}
+
+rdsparser_slc_t
+rdsparser_get_slc(const rdsparser_t       *rds,
+                  rdsparser_slc_variant_t  variant)
+{
+    if (variant >= RDSPARSER_SLC_VARIANT_COUNT)
+    {
+        return RDSPARSER_SLC_UNKNOWN;
+    }
+
+    return rdsparser_buffer_get_slc(&rds->buffer, variant);
+}
+
 void
 rdsparser_add_af(rdsparser_t *rds,
                  uint8_t      new_af)
 {
-    if (rdsparser_buffer_add_af(&rds->buffer, new_af))
+    const bool added = rdsparser_buffer_add_af(&rds->buffer, new_af);
+
+#ifndef RDSPARSER_DISABLE_AF
+    if (rds->af_ageing &&
+        rdsparser_af_get(rdsparser_buffer_get_af(&rds->buffer), new_af))
     {
-        if (rds->callback_af)
+        rdsparser_af_table_hit(&rds->af_table, new_af, rds->time);
+    }
+#endif
+
+    if (added)
+    {
+        rdsparser_json_mark(&rds->json, RDSPARSER_JSON_DIRTY_AF);
+        if (rds->handlers->af)
         {
-            const uint32_t frequency = 87500 + (uint32_t)new_af * 100;
-            rds->callback_af(rds, frequency, rds->user_data);
+            rds->handlers->af(rds, rdsparser_af_get_frequency(new_af), rds->user_data);
         }
     }
 }
@@ -303,7 +1074,14 @@ const rdsparser_string_t*
 rdsparser_get_rt(const rdsparser_t   *rds,
                  rdsparser_rt_flag_t  flag)
 {
-    return rds->rt[!!flag];
+    return rds->rt[RDSPARSER_RT_BUFFER(!!flag)];
+}
+
+bool
+rdsparser_get_rt_complete(const rdsparser_t   *rds,
+                          rdsparser_rt_flag_t  flag)
+{
+    return rds->rt_state[RDSPARSER_RT_BUFFER(!!flag)].complete;
 }
 
 const rdsparser_string_t*
@@ -312,6 +1090,112 @@ rdsparser_get_ptyn(const rdsparser_t *rds)
     return rds->ptyn;
 }
 
+const rdsparser_string_t*
+rdsparser_get_lps(const rdsparser_t *rds)
+{
+    return rds->lps;
+}
+
+const rdsparser_string_t*
+rdsparser_get_ert(const rdsparser_t *rds)
+{
+    return rds->ert;
+}
+
+uint8_t
+rdsparser_get_eon_count(const rdsparser_t *rds)
+{
+    return rds->eon.count;
+}
+
+const rdsparser_eon_t*
+rdsparser_get_eon(const rdsparser_t *rds,
+                  uint8_t            index)
+{
+    if (index < rds->eon.count)
+    {
+        return &rds->eon.entry[rds->eon.order[index]];
+    }
+
+    return NULL;
+}
+
+const rdsparser_eon_t*
+rdsparser_get_eon_pi(const rdsparser_t *rds,
+                     rdsparser_pi_t     pi)
+{
+    if (pi < 0 || pi > UINT16_MAX)
+    {
+        return NULL;
+    }
+
+    return rdsparser_eon_table_lookup((rdsparser_eon_table_t*)&rds->eon, (uint16_t)pi);
+}
+
+bool
+rdsparser_get_rtplus_running(const rdsparser_t *rds)
+{
+    return rds->rtplus.running;
+}
+
+uint8_t
+rdsparser_get_rtplus_count(const rdsparser_t *rds)
+{
+    return rds->rtplus.count;
+}
+
+const rdsparser_rtplus_tag_t*
+rdsparser_get_rtplus(const rdsparser_t *rds,
+                     uint8_t            index)
+{
+    if (index < rds->rtplus.count)
+    {
+        return &rds->rtplus.tag[index];
+    }
+
+    return NULL;
+}
+
+const rdsparser_rtplus_tag_t*
+rdsparser_get_rtplus_type(const rdsparser_t       *rds,
+                          rdsparser_rtplus_type_t  type)
+{
+    for (uint8_t i = 0; i < rds->rtplus.count; i++)
+    {
+        if (rds->rtplus.tag[i].type == type)
+        {
+            return &rds->rtplus.tag[i];
+        }
+    }
+
+    return NULL;
+}
+
+uint16_t
+rdsparser_get_oda(const rdsparser_t *rds,
+                  uint8_t            group,
+                  bool               flag)
+{
+    if (group > 15)
+    {
+        return RDSPARSER_ODA_AID_NONE;
+    }
+
+    return rds->oda.group[RDSPARSER_ODA_INDEX(group, flag)].aid;
+}
+
+uint8_t
+rdsparser_get_tmc_pending(const rdsparser_t *rds)
+{
+    return (uint8_t)(rds->tmc.head - rds->tmc.tail);
+}
+
+uint32_t
+rdsparser_get_tmc_overflow(const rdsparser_t *rds)
+{
+    return rds->tmc.overflow;
+}
+
 void
 rdsparser_set_user_data(rdsparser_t *rds,
                         void        *user_data)
@@ -319,86 +1203,210 @@ rdsparser_set_user_data(rdsparser_t *rds,
     rds->user_data = user_data;
 }
 
+void*
+rdsparser_get_user_data(const rdsparser_t *rds)
+{
+    return rds->user_data;
+}
+
+void
+rdsparser_set_handlers(rdsparser_t                *rds,
+                       const rdsparser_handlers_t *handlers)
+{
+    rds->handlers = handlers ? handlers : &rdsparser_handlers_none;
+}
+
+const rdsparser_handlers_t*
+rdsparser_get_handlers(const rdsparser_t *rds)
+{
+    return rds->handlers;
+}
+
+/* Copy of the current handlers modified by rdsparser_register_* */
+static rdsparser_handlers_t*
+rdsparser_handlers_own(rdsparser_t *rds)
+{
+    if (rds->handlers != &rds->handlers_own)
+    {
+        rds->handlers_own = *rds->handlers;
+        rds->handlers = &rds->handlers_own;
+    }
+
+    return &rds->handlers_own;
+}
+
 void
 rdsparser_register_pi(rdsparser_t  *rds,
                       void        (*callback_pi)(rdsparser_t*, void*))
 {
-    rds->callback_pi = callback_pi;
+    rdsparser_handlers_own(rds)->pi = callback_pi;
 }
 
 void
 rdsparser_register_pty(rdsparser_t  *rds,
                        void        (*callback_pty)(rdsparser_t*, void*))
 {
-    rds->callback_pty = callback_pty;
+    rdsparser_handlers_own(rds)->pty = callback_pty;
 }
 
 void
 rdsparser_register_tp(rdsparser_t  *rds,
                       void        (*callback_tp)(rdsparser_t*, void*))
 {
-    rds->callback_tp = callback_tp;
+    rdsparser_handlers_own(rds)->tp = callback_tp;
 }
 
 void
 rdsparser_register_ta(rdsparser_t  *rds,
                       void        (*callback_ta)(rdsparser_t*, void*))
 {
-    rds->callback_ta = callback_ta;
+    rdsparser_handlers_own(rds)->ta = callback_ta;
 }
 
 void
 rdsparser_register_ms(rdsparser_t  *rds,
                       void        (*callback_ms)(rdsparser_t*, void*))
 {
-    rds->callback_ms = callback_ms;
+    rdsparser_handlers_own(rds)->ms = callback_ms;
 }
 
 void
 rdsparser_register_ecc(rdsparser_t  *rds,
                        void        (*callback_ecc)(rdsparser_t*, void*))
 {
-    rds->callback_ecc = callback_ecc;
+    rdsparser_handlers_own(rds)->ecc = callback_ecc;
 }
 
 void
 rdsparser_register_country(rdsparser_t  *rds,
                            void        (*callback_country)(rdsparser_t*, void*))
 {
-    rds->callback_country = callback_country;
+    rdsparser_handlers_own(rds)->country = callback_country;
+}
+
+void
+rdsparser_register_pin(rdsparser_t  *rds,
+                       void        (*callback_pin)(rdsparser_t*, void*))
+{
+    rdsparser_handlers_own(rds)->pin = callback_pin;
+}
+
+void
+rdsparser_register_la(rdsparser_t  *rds,
+                      void        (*callback_la)(rdsparser_t*, void*))
+{
+    rdsparser_handlers_own(rds)->la = callback_la;
+}
+
+void
+rdsparser_register_slc(rdsparser_t  *rds,
+                       void        (*callback_slc)(rdsparser_t*, rdsparser_slc_variant_t, void*))
+{
+    rdsparser_handlers_own(rds)->slc = callback_slc;
 }
 
 void
 rdsparser_register_af(rdsparser_t  *rds,
                       void        (*callback_af)(rdsparser_t*, uint32_t, void*))
 {
-    rds->callback_af = callback_af;
+    rdsparser_handlers_own(rds)->af = callback_af;
+}
+
+void
+rdsparser_register_af_expire(rdsparser_t  *rds,
+                             void        (*callback_af_expire)(rdsparser_t*, uint32_t, void*))
+{
+    rdsparser_handlers_own(rds)->af_expire = callback_af_expire;
 }
 
 void
 rdsparser_register_ps(rdsparser_t  *rds,
                       void        (*callback_ps)(rdsparser_t*, void*))
 {
-    rds->callback_ps = callback_ps;
+    rdsparser_handlers_own(rds)->ps = callback_ps;
 }
 
 void
 rdsparser_register_rt(rdsparser_t  *rds,
                       void        (*callback_rt)(rdsparser_t*, rdsparser_rt_flag_t, void*))
 {
-    rds->callback_rt = callback_rt;
+    rdsparser_handlers_own(rds)->rt = callback_rt;
+}
+
+void
+rdsparser_register_rt_complete(rdsparser_t  *rds,
+                               void        (*callback_rt_complete)(rdsparser_t*, rdsparser_rt_flag_t, void*))
+{
+    rdsparser_handlers_own(rds)->rt_complete = callback_rt_complete;
 }
 
 void
 rdsparser_register_ptyn(rdsparser_t  *rds,
                         void        (*callback_ptyn)(rdsparser_t*, void*))
 {
-    rds->callback_ptyn = callback_ptyn;
+    rdsparser_handlers_own(rds)->ptyn = callback_ptyn;
+}
+
+void
+rdsparser_register_lps(rdsparser_t  *rds,
+                       void        (*callback_lps)(rdsparser_t*, void*))
+{
+    rdsparser_handlers_own(rds)->lps = callback_lps;
+}
+
+void
+rdsparser_register_ert(rdsparser_t  *rds,
+                       void        (*callback_ert)(rdsparser_t*, void*))
+{
+    rdsparser_handlers_own(rds)->ert = callback_ert;
 }
 
 void
 rdsparser_register_ct(rdsparser_t  *rds,
                       void        (*callback_ct)(rdsparser_t*, const rdsparser_ct_t*, void*))
 {
-    rds->callback_ct = callback_ct;
+    rdsparser_handlers_own(rds)->ct = callback_ct;
+}
+
+void
+rdsparser_register_eon(rdsparser_t  *rds,
+                       void        (*callback_eon)(rdsparser_t*, const rdsparser_eon_t*, void*))
+{
+    rdsparser_handlers_own(rds)->eon = callback_eon;
+}
+
+void
+rdsparser_register_eon_ta(rdsparser_t  *rds,
+                          void        (*callback_eon_ta)(rdsparser_t*, const rdsparser_eon_t*, void*))
+{
+    rdsparser_handlers_own(rds)->eon_ta = callback_eon_ta;
+}
+
+void
+rdsparser_register_rtplus(rdsparser_t  *rds,
+                          void        (*callback_rtplus)(rdsparser_t*, const rdsparser_rtplus_tag_t*, void*))
+{
+    rdsparser_handlers_own(rds)->rtplus = callback_rtplus;
+}
+
+void
+rdsparser_register_oda_announce(rdsparser_t  *rds,
+                                void        (*callback_oda)(rdsparser_t*, uint8_t, bool, uint16_t, void*))
+{
+    rdsparser_handlers_own(rds)->oda_announce = callback_oda;
+}
+
+bool
+rdsparser_register_oda(rdsparser_t              *rds,
+                       uint16_t                  aid,
+                       rdsparser_oda_callback_t  callback)
+{
+    return rdsparser_oda_register(&rds->oda, aid, callback);
+}
+
+void
+rdsparser_register_tmc(rdsparser_t  *rds,
+                       void        (*callback_tmc)(rdsparser_t*, void*))
+{
+    rdsparser_handlers_own(rds)->tmc = callback_tmc;
 }
@@ -24,6 +24,9 @@ void rdsparser_set_ta(rdsparser_t *rds, rdsparser_ta_t ta);
 void rdsparser_set_ms(rdsparser_t *rds, rdsparser_ms_t ms);
 void rdsparser_set_ecc(rdsparser_t *rds, rdsparser_ecc_t ecc);
 void rdsparser_set_country(rdsparser_t *rds, rdsparser_country_t country);
+void rdsparser_set_pin(rdsparser_t *rds, rdsparser_pin_t pin);
+void rdsparser_set_la(rdsparser_t *rds, rdsparser_la_t la);
+void rdsparser_set_slc(rdsparser_t *rds, rdsparser_slc_variant_t variant, rdsparser_slc_t value);
 void rdsparser_add_af(rdsparser_t *rds, uint8_t new_af);
 
 #endif
\ No newline at end of file
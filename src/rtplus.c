@@ -0,0 +1,244 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <librdsparser_private.h>
+#include "rtplus.h"
+#include "string.h"
+
+static inline bool
+rdsparser_rtplus_get_toggle(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_B] & 0x10) >> 4;
+}
+
+static inline bool
+rdsparser_rtplus_get_running(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_B] & 0x08) >> 3;
+}
+
+static inline rdsparser_rtplus_type_t
+rdsparser_rtplus_get_type1(const rdsparser_data_t data)
+{
+    return ((data[RDSPARSER_BLOCK_B] & 0x07) << 3) | (data[RDSPARSER_BLOCK_C] >> 13);
+}
+
+static inline uint8_t
+rdsparser_rtplus_get_start1(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] >> 7) & 0x3F;
+}
+
+static inline uint8_t
+rdsparser_rtplus_get_length1(const rdsparser_data_t data)
+{
+    /* Additional length, excluding the first character */
+    return ((data[RDSPARSER_BLOCK_C] >> 1) & 0x3F) + 1;
+}
+
+static inline rdsparser_rtplus_type_t
+rdsparser_rtplus_get_type2(const rdsparser_data_t data)
+{
+    return ((data[RDSPARSER_BLOCK_C] & 0x01) << 5) | (data[RDSPARSER_BLOCK_D] >> 11);
+}
+
+static inline uint8_t
+rdsparser_rtplus_get_start2(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_D] >> 5) & 0x3F;
+}
+
+static inline uint8_t
+rdsparser_rtplus_get_length2(const rdsparser_data_t data)
+{
+    /* Additional length, excluding the first character */
+    return (data[RDSPARSER_BLOCK_D] & 0x1F) + 1;
+}
+
+static inline void
+rdsparser_rtplus_notify(rdsparser_t                  *rds,
+                        const rdsparser_rtplus_tag_t *tag)
+{
+    if (rds->handlers->rtplus)
+    {
+        rds->handlers->rtplus(rds, tag, rds->user_data);
+    }
+}
+
+static bool
+rdsparser_rtplus_update_tag(rdsparser_rtplus_t      *rtplus,
+                            rdsparser_rtplus_type_t  type,
+                            uint8_t                  start,
+                            uint8_t                  length,
+                            rdsparser_rt_flag_t      flag,
+                            rdsparser_rtplus_tag_t **out)
+{
+    if (type == RDSPARSER_RTPLUS_DUMMY_CLASS ||
+        start + length > RDSPARSER_RT_LENGTH)
+    {
+        return false;
+    }
+
+    uint8_t i;
+    for (i = 0; i < rtplus->count; i++)
+    {
+        if (rtplus->tag[i].type == type)
+        {
+            break;
+        }
+    }
+
+    if (i == RDSPARSER_RTPLUS_TAG_COUNT)
+    {
+        /* No free slot, replace the oldest tag */
+        for (i = 1; i < RDSPARSER_RTPLUS_TAG_COUNT; i++)
+        {
+            rtplus->tag[i - 1] = rtplus->tag[i];
+        }
+
+        i = RDSPARSER_RTPLUS_TAG_COUNT - 1;
+        rtplus->tag[i].type = RDSPARSER_RTPLUS_DUMMY_CLASS;
+    }
+    else if (i == rtplus->count)
+    {
+        rtplus->count++;
+        rtplus->tag[i].type = RDSPARSER_RTPLUS_DUMMY_CLASS;
+    }
+
+    rdsparser_rtplus_tag_t *tag = &rtplus->tag[i];
+    *out = tag;
+
+    if (tag->type == type &&
+        tag->start == start &&
+        tag->length == length &&
+        tag->flag == flag)
+    {
+        return false;
+    }
+
+    tag->type = type;
+    tag->start = start;
+    tag->length = length;
+    tag->flag = flag;
+    return true;
+}
+
+void
+rdsparser_rtplus_clear(rdsparser_rtplus_t *rtplus)
+{
+    rtplus->toggle = -1;
+    rtplus->running = false;
+    rtplus->count = 0;
+}
+
+void
+rdsparser_rtplus_parse(rdsparser_t             *rds,
+                       const rdsparser_data_t   data,
+                       const rdsparser_error_t  errors)
+{
+    rdsparser_rtplus_t *rtplus = &rds->rtplus;
+    rdsparser_rtplus_tag_t *tag;
+
+    if (errors[RDSPARSER_BLOCK_B] != 0 ||
+        errors[RDSPARSER_BLOCK_C] != 0 ||
+        rds->last_rt_flag == -1)
+    {
+        /* Tags refer to the current RadioText */
+        return;
+    }
+
+    const int8_t toggle = rdsparser_rtplus_get_toggle(data);
+    if (toggle != rtplus->toggle)
+    {
+        /* New item, previous tags are no longer valid */
+        rtplus->toggle = toggle;
+        rtplus->count = 0;
+    }
+
+    rtplus->running = rdsparser_rtplus_get_running(data);
+
+    if (rdsparser_rtplus_update_tag(rtplus,
+                                    rdsparser_rtplus_get_type1(data),
+                                    rdsparser_rtplus_get_start1(data),
+                                    rdsparser_rtplus_get_length1(data),
+                                    (rdsparser_rt_flag_t)rds->last_rt_flag,
+                                    &tag))
+    {
+        rdsparser_rtplus_notify(rds, tag);
+    }
+
+    if (errors[RDSPARSER_BLOCK_D] == 0 &&
+        rdsparser_rtplus_update_tag(rtplus,
+                                    rdsparser_rtplus_get_type2(data),
+                                    rdsparser_rtplus_get_start2(data),
+                                    rdsparser_rtplus_get_length2(data),
+                                    (rdsparser_rt_flag_t)rds->last_rt_flag,
+                                    &tag))
+    {
+        rdsparser_rtplus_notify(rds, tag);
+    }
+}
+
+void
+rdsparser_rtplus_update_text(rdsparser_t         *rds,
+                             rdsparser_rt_flag_t  flag,
+                             uint8_t              start,
+                             uint8_t              end)
+{
+    const rdsparser_rtplus_t *rtplus = &rds->rtplus;
+
+    for (uint8_t i = 0; i < rtplus->count; i++)
+    {
+        const rdsparser_rtplus_tag_t *tag = &rtplus->tag[i];
+        if (tag->flag == flag &&
+            tag->start < end &&
+            start < tag->start + tag->length)
+        {
+            rdsparser_rtplus_notify(rds, tag);
+        }
+    }
+}
+
+rdsparser_rtplus_type_t
+rdsparser_rtplus_tag_get_type(const rdsparser_rtplus_tag_t *tag)
+{
+    return tag->type;
+}
+
+uint8_t
+rdsparser_rtplus_tag_get_start(const rdsparser_rtplus_tag_t *tag)
+{
+    return tag->start;
+}
+
+uint8_t
+rdsparser_rtplus_tag_get_length(const rdsparser_rtplus_tag_t *tag)
+{
+    return tag->length;
+}
+
+rdsparser_rt_flag_t
+rdsparser_rtplus_tag_get_flag(const rdsparser_rtplus_tag_t *tag)
+{
+    return tag->flag;
+}
+
+const rdsparser_string_char_t*
+rdsparser_rtplus_tag_get_content(const rdsparser_t            *rds,
+                                 const rdsparser_rtplus_tag_t *tag)
+{
+    return rdsparser_string_get_content(rds->rt[RDSPARSER_RT_BUFFER(tag->flag)]) + tag->start;
+}
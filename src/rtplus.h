@@ -0,0 +1,27 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_RTPLUS_H
+#define RDSPARSER_RTPLUS_H
+#include <librdsparser_private.h>
+
+#define RDSPARSER_RTPLUS_AID 0x4BD7
+
+void rdsparser_rtplus_clear(rdsparser_rtplus_t *rtplus);
+void rdsparser_rtplus_parse(rdsparser_t *rds, const rdsparser_data_t data, const rdsparser_error_t errors);
+void rdsparser_rtplus_update_text(rdsparser_t *rds, rdsparser_rt_flag_t flag, uint8_t start, uint8_t end);
+
+#endif
\ No newline at end of file
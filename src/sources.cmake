@@ -0,0 +1,75 @@
+# Source files of the library, also read by cmake/amalgamate.cmake
+
+set(SOURCE_FILES
+        af.c
+        af.h
+        buffer.c
+        buffer.h
+        charset.c
+        charset.h
+        eon.c
+        eon.h
+        event.c
+        event.h
+        ert.c
+        ert.h
+        group.c
+        group.h
+        group0.c
+        group0.h
+        group2.c
+        group2.h
+        group3.c
+        group3.h
+        group14.c
+        group14.h
+        group15.c
+        group15.h
+        json.c
+        json.h
+        log.c
+        log.h
+        oda.c
+        oda.h
+        rdsparser.c
+        parser.c
+        parser.h
+        rtplus.c
+        rtplus.h
+        string.c
+        string.h
+        tmc.c
+        tmc.h
+        ttl.c
+        ttl.h
+        utils.c
+        utils.h)
+
+# Optional features, see RDSPARSER_FEATURES
+set(LOOKUPS_SOURCE_FILES
+        country.c
+        pty.c)
+
+set(GROUP1_SOURCE_FILES
+        ecc.c
+        ecc.h
+        group1.c
+        group1.h
+        pin.c)
+
+set(GROUP4_SOURCE_FILES
+        ct.c
+        ct.h
+        group4.c
+        group4.h)
+
+set(GROUP10_SOURCE_FILES
+        group10.c
+        group10.h)
+
+set(STATION_CACHE_SOURCE_FILES
+        station.c
+        station.h)
+
+set(FILE_SOURCE_FILES
+        file.c)
@@ -0,0 +1,167 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <librdsparser_private.h>
+#include "station.h"
+#include "buffer.h"
+#include "af.h"
+#include "string.h"
+
+static void
+rdsparser_station_copy(rdsparser_string_t       *dest,
+                       const rdsparser_string_t *src,
+                       size_t                    size)
+{
+    /* Size in bytes, the characters are wider with the unicode support */
+    for (size_t i = 0; i < size / sizeof(rdsparser_string_t); i++)
+    {
+        dest[i] = src[i];
+    }
+}
+
+static void
+rdsparser_station_clear(rdsparser_station_t *station)
+{
+    station->pi = RDSPARSER_PI_UNKNOWN;
+    station->frequency = 0;
+    rdsparser_af_clear(&station->af);
+    rdsparser_string_clear(station->ps);
+    for (uint8_t i = 0; i < RDSPARSER_RT_BUFFER_COUNT; i++)
+    {
+        rdsparser_string_clear(station->rt[i]);
+    }
+    rdsparser_string_clear(station->ptyn);
+}
+
+static void
+rdsparser_station_table_use(rdsparser_station_table_t *table,
+                            uint8_t                    position)
+{
+    const uint8_t index = table->order[position];
+
+    for (uint8_t i = position; i > 0; i--)
+    {
+        table->order[i] = table->order[i - 1];
+    }
+
+    table->order[0] = index;
+}
+
+void
+rdsparser_station_table_init(rdsparser_station_table_t *table)
+{
+    for (uint8_t i = 0; i < RDSPARSER_STATION_CACHE_SIZE; i++)
+    {
+        rdsparser_station_t *station = &table->entry[i];
+        rdsparser_string_init(station->ps, RDSPARSER_PS_LENGTH, RDSPARSER_STRING_ENCODING_BASIC);
+        for (uint8_t j = 0; j < RDSPARSER_RT_BUFFER_COUNT; j++)
+        {
+            rdsparser_string_init(station->rt[j], RDSPARSER_RT_LENGTH, RDSPARSER_STRING_ENCODING_BASIC);
+        }
+        rdsparser_string_init(station->ptyn, RDSPARSER_PTYN_LENGTH, RDSPARSER_STRING_ENCODING_BASIC);
+    }
+
+    rdsparser_station_table_clear(table);
+}
+
+void
+rdsparser_station_table_clear(rdsparser_station_table_t *table)
+{
+    for (uint8_t i = 0; i < RDSPARSER_STATION_CACHE_SIZE; i++)
+    {
+        rdsparser_station_clear(&table->entry[i]);
+        table->order[i] = i;
+    }
+
+    table->count = 0;
+}
+
+rdsparser_station_t*
+rdsparser_station_table_lookup(rdsparser_station_table_t *table,
+                               rdsparser_pi_t             pi,
+                               uint32_t                   frequency)
+{
+    for (uint8_t i = 0; i < table->count; i++)
+    {
+        rdsparser_station_t *station = &table->entry[table->order[i]];
+        if (station->pi == pi &&
+            station->frequency == frequency)
+        {
+            rdsparser_station_table_use(table, i);
+            return station;
+        }
+    }
+
+    return NULL;
+}
+
+rdsparser_station_t*
+rdsparser_station_table_insert(rdsparser_station_table_t *table,
+                               rdsparser_pi_t             pi,
+                               uint32_t                   frequency)
+{
+    rdsparser_station_t *station = rdsparser_station_table_lookup(table, pi, frequency);
+    if (station)
+    {
+        return station;
+    }
+
+    /* Take a free entry or evict the least recently used one */
+    const uint8_t position = (table->count < RDSPARSER_STATION_CACHE_SIZE) ? table->count++
+                                                                           : RDSPARSER_STATION_CACHE_SIZE - 1;
+    station = &table->entry[table->order[position]];
+    rdsparser_station_clear(station);
+    station->pi = pi;
+    station->frequency = frequency;
+    rdsparser_station_table_use(table, position);
+    return station;
+}
+
+void
+rdsparser_station_save(rdsparser_station_t *station,
+                       const rdsparser_t   *rds)
+{
+    station->af = *rdsparser_buffer_get_af(&rds->buffer);
+    rdsparser_station_copy(station->ps, rds->ps, sizeof(station->ps));
+    rdsparser_station_copy(station->rt[0], rds->rt[0], sizeof(station->rt));
+    rdsparser_station_copy(station->ptyn, rds->ptyn, sizeof(station->ptyn));
+}
+
+void
+rdsparser_station_restore(const rdsparser_station_t *station,
+                          rdsparser_t               *rds)
+{
+    rdsparser_buffer_set_af(&rds->buffer, &station->af);
+    rdsparser_station_copy(rds->ps, station->ps, sizeof(station->ps));
+    rdsparser_station_copy(rds->rt[0], station->rt[0], sizeof(station->rt));
+    rdsparser_station_copy(rds->ptyn, station->ptyn, sizeof(station->ptyn));
+}
+
+void
+rdsparser_station_reset(rdsparser_t *rds)
+{
+    rdsparser_af_t af;
+    rdsparser_af_clear(&af);
+    rdsparser_buffer_set_af(&rds->buffer, &af);
+    rdsparser_string_clear(rds->ps);
+    for (uint8_t i = 0; i < RDSPARSER_RT_BUFFER_COUNT; i++)
+    {
+        rdsparser_string_clear(rds->rt[i]);
+    }
+    rdsparser_string_clear(rds->ptyn);
+}
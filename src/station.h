@@ -0,0 +1,30 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_STATION_H
+#define RDSPARSER_STATION_H
+#include <librdsparser_private.h>
+
+void rdsparser_station_table_init(rdsparser_station_table_t *table);
+void rdsparser_station_table_clear(rdsparser_station_table_t *table);
+rdsparser_station_t* rdsparser_station_table_lookup(rdsparser_station_table_t *table, rdsparser_pi_t pi, uint32_t frequency);
+rdsparser_station_t* rdsparser_station_table_insert(rdsparser_station_table_t *table, rdsparser_pi_t pi, uint32_t frequency);
+
+void rdsparser_station_save(rdsparser_station_t *station, const rdsparser_t *rds);
+void rdsparser_station_restore(const rdsparser_station_t *station, rdsparser_t *rds);
+void rdsparser_station_reset(rdsparser_t *rds);
+
+#endif
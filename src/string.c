@@ -18,12 +18,15 @@
 #include <stdbool.h>
 #include <librdsparser_private.h>
 #include "string.h"
+#include "charset.h"
 
 void
-rdsparser_string_init(rdsparser_string_t *string,
-                      uint8_t             max_length)
+rdsparser_string_init(rdsparser_string_t          *string,
+                      uint8_t                      max_length,
+                      rdsparser_string_encoding_t  encoding)
 {
-    *string = max_length;
+    string[0] = max_length;
+    string[1] = encoding;
 }
 
 static uint8_t
@@ -32,6 +35,12 @@ rdsparser_string_get_size(const rdsparser_string_t *string)
     return (uint8_t)string[0];
 }
 
+rdsparser_string_encoding_t
+rdsparser_string_get_encoding(const rdsparser_string_t *string)
+{
+    return (rdsparser_string_encoding_t)string[1];
+}
+
 uint8_t
 rdsparser_string_get_length(const rdsparser_string_t *string)
 {
@@ -51,14 +60,14 @@ rdsparser_string_get_length(const rdsparser_string_t *string)
 const rdsparser_string_char_t*
 rdsparser_string_get_content(const rdsparser_string_t *string)
 {
-    return (string + 1);
+    return (string + 2);
 }
 
 const rdsparser_string_error_t*
 rdsparser_string_get_errors(const rdsparser_string_t *string)
 {
     const uint8_t size = rdsparser_string_get_size(string);
-    return (uint8_t*)(string + 1 + size + 1);
+    return (uint8_t*)(string + 2 + size + 1);
 }
 
 bool
@@ -100,56 +109,6 @@ rdsparser_string_calculate_error(rdsparser_block_error_t info_error,
     return (rdsparser_string_error_t)(value ? value - 1 : 0);
 }
 
-static rdsparser_string_char_t
-rdsparser_string_convert(uint8_t input)
-{
-    if (input == '\r')
-    {
-        return '\0';
-    }
-
-#ifdef RDSPARSER_DISABLE_UNICODE
-    return input;
-#else
-    const uint8_t offset = 0x20;
-    const wchar_t charset[] =
-    {
-        L' ', L'!', L'"', L'#', L'¤', L'%', L'&', L'\'',
-        L'(', L')', L'*', L'+', L',', L'-', L'.', L'/',
-        L'0', L'1', L'2', L'3', L'4', L'5', L'6', L'7',
-        L'8', L'9', L':', L';', L'<', L'=', L'>', L'?',
-        L'@', L'A', L'B', L'C', L'D', L'E', L'F', L'G',
-        L'H', L'I', L'J', L'K', L'L', L'M', L'N', L'O',
-        L'P', L'Q', L'R', L'S', L'T', L'U', L'V', L'W',
-        L'X', L'Y', L'Z', L'[', L'\\',L']', L'―', L'_',
-        L'‖', L'a', L'b', L'c', L'd', L'e', L'f', L'g',
-        L'h', L'i', L'j', L'k', L'l', L'm', L'n', L'o',
-        L'p', L'q', L'r', L's', L't', L'u', L'v', L'w',
-        L'x', L'y', L'z', L'{', L'|', L'}', L'¯', L' ',
-        L'á', L'à', L'é', L'è', L'í', L'ì', L'ó', L'ò',
-        L'ú', L'ù', L'Ñ', L'Ç', L'Ş', L'β', L'¡', L'Ĳ',
-        L'â', L'ä', L'ê', L'ë', L'î', L'ï', L'ô', L'ö',
-        L'û', L'ü', L'ñ', L'ç', L'ş', L'ǧ', L'ı', L'ĳ',
-        L'ª', L'α', L'©', L'‰', L'Ǧ', L'ě', L'ň', L'ő',
-        L'π', L'€', L'£', L'$', L'←', L'↑', L'→', L'↓',
-        L'º', L'¹', L'²', L'³', L'±', L'İ', L'ń', L'ű',
-        L'µ', L'¿', L'÷', L'°', L'¼', L'½', L'¾', L'§',
-        L'Á', L'À', L'É', L'È', L'Í', L'Ì', L'Ó', L'Ò',
-        L'Ú', L'Ù', L'Ř', L'Č', L'Š', L'Ž', L'Ð', L'Ŀ',
-        L'Â', L'Ä', L'Ê', L'Ë', L'Î', L'Ï', L'Ô', L'Ö',
-        L'Û', L'Ü', L'ř', L'č', L'š', L'ž', L'đ', L'ŀ',
-        L'Ã', L'Å', L'Æ', L'Œ', L'ŷ', L'Ý', L'Õ', L'Ø',
-        L'Þ', L'Ŋ', L'Ŕ', L'Ć', L'Ś', L'Ź', L'Ŧ', L'ð',
-        L'ã', L'å', L'æ', L'œ', L'ŵ', L'ý', L'õ', L'ø',
-        L'þ', L'ŋ', L'ŕ', L'ć', L'ś', L'ź', L'ŧ', L' '
-    };
-
-    /* TODO: Implement SO and LS2 tables (and charset detection) */
-    const wchar_t fallback_char = L' ';
-    return (input < offset ? fallback_char : charset[input - offset]);
-#endif
-}
-
 static bool
 rdsparser_string_update_single(rdsparser_string_t      *string,
                                uint8_t                  input,
@@ -162,6 +121,9 @@ rdsparser_string_update_single(rdsparser_string_t      *string,
     rdsparser_string_char_t *output = (rdsparser_string_char_t*)rdsparser_string_get_content(string);
     rdsparser_string_error_t *output_errors = (rdsparser_string_error_t*)rdsparser_string_get_errors(string);
     rdsparser_string_error_t error = rdsparser_string_calculate_error(info_error, data_error);
+    const bool utf8 = (rdsparser_string_get_encoding(string) == RDSPARSER_STRING_ENCODING_UTF8);
+    const uint8_t charset = (utf8 ? RDSPARSER_CHARSET_RAW : RDSPARSER_CHARSET_G0);
+    const uint16_t entry = rdsparser_charset_lookup(charset, input);
 
     if (progressive &&
         output_errors[position] < error)
@@ -170,8 +132,9 @@ rdsparser_string_update_single(rdsparser_string_t      *string,
         return false;
     }
 
-    if (input == '\r')
+    switch (RDSPARSER_CHARSET_CLASS(entry))
     {
+    case RDSPARSER_CHARSET_CLASS_EOL:
         if (!allow_eol ||
             info_error != RDSPARSER_BLOCK_ERROR_NONE ||
             data_error != RDSPARSER_BLOCK_ERROR_NONE)
@@ -179,15 +142,9 @@ rdsparser_string_update_single(rdsparser_string_t      *string,
             /* Only error-free line endings */
             return false;
         }
-    }
-    else if (input < 0x20)
-    {
-        /* Not printable character */
-        return false;
-    }
+        break;
 
-    if (input >= 0x7F)
-    {
+    case RDSPARSER_CHARSET_CLASS_SPECIAL:
         if (info_error != RDSPARSER_BLOCK_ERROR_NONE ||
             data_error != RDSPARSER_BLOCK_ERROR_NONE)
         {
@@ -195,12 +152,34 @@ rdsparser_string_update_single(rdsparser_string_t      *string,
                so use only error-free info and data */
             return false;
         }
+        break;
+
+    case RDSPARSER_CHARSET_CLASS_BASIC:
+        break;
+
+    default:
+        /* Not printable character */
+        return false;
+    }
+
 #ifdef RDSPARSER_DISABLE_UNICODE
-        input = ' ';
-#endif
+    rdsparser_string_char_t character;
+    if (RDSPARSER_CHARSET_CLASS(entry) == RDSPARSER_CHARSET_CLASS_EOL)
+    {
+        character = '\0';
+    }
+    else if (utf8 || RDSPARSER_CHARSET_CLASS(entry) == RDSPARSER_CHARSET_CLASS_BASIC)
+    {
+        character = input;
+    }
+    else
+    {
+        character = ' ';
     }
+#else
+    const rdsparser_string_char_t character = RDSPARSER_CHARSET_CODE(entry);
+#endif
 
-    rdsparser_string_char_t character = rdsparser_string_convert(input);
     if (output[position] == character &&
         output_errors[position] <= error)
     {
@@ -223,12 +202,23 @@ rdsparser_string_update(rdsparser_string_t      *string,
                         bool                     allow_eol)
 {
     const uint8_t chunk_length = 2;
+    const char *chunk = input;
     bool changed = false;
 
+    if (rdsparser_string_get_encoding(string) == RDSPARSER_STRING_ENCODING_BASIC &&
+        info_error == RDSPARSER_BLOCK_ERROR_NONE &&
+        data_error == RDSPARSER_BLOCK_ERROR_NONE &&
+        rdsparser_charset_is_switch(input))
+    {
+        /* Only G0 is supported, but the positions of
+           a code table switch are received as spaces */
+        chunk = "  ";
+    }
+
     for (uint8_t i = 0; i < chunk_length; i++)
     {
         changed |= rdsparser_string_update_single(string,
-                                                  input[i],
+                                                  chunk[i],
                                                   info_error,
                                                   data_error,
                                                   position + i,
@@ -238,3 +228,169 @@ rdsparser_string_update(rdsparser_string_t      *string,
 
     return changed;
 }
+
+static size_t
+rdsparser_string_encode_utf8(uint32_t  code,
+                             char     *output,
+                             size_t    size)
+{
+    if (code < 0x80)
+    {
+        if (size < 1)
+        {
+            return 0;
+        }
+
+        output[0] = (char)code;
+        return 1;
+    }
+
+    if (code < 0x800)
+    {
+        if (size < 2)
+        {
+            return 0;
+        }
+
+        output[0] = (char)(0xC0 | (code >> 6));
+        output[1] = (char)(0x80 | (code & 0x3F));
+        return 2;
+    }
+
+    if (size < 3)
+    {
+        return 0;
+    }
+
+    output[0] = (char)(0xE0 | (code >> 12));
+    output[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+    output[2] = (char)(0x80 | (code & 0x3F));
+    return 3;
+}
+
+/* Length of a well-formed UTF-8 sequence at the position, or 0 if it is
+   invalid. The number of bytes to replace with U+FFFD is stored in skip. */
+static uint8_t
+rdsparser_string_check_utf8(const rdsparser_string_char_t *content,
+                            uint8_t                        length,
+                            uint8_t                        position,
+                            uint8_t                       *skip)
+{
+    const uint8_t lead = (uint8_t)content[position];
+    uint8_t count;
+    uint8_t min = 0x80;
+    uint8_t max = 0xBF;
+
+    if (lead < 0x80)
+    {
+        return 1;
+    }
+    else if (lead >= 0xC2 && lead <= 0xDF)
+    {
+        count = 2;
+    }
+    else if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        count = 3;
+        min = (lead == 0xE0) ? 0xA0 : 0x80;
+        max = (lead == 0xED) ? 0x9F : 0xBF;
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        count = 4;
+        min = (lead == 0xF0) ? 0x90 : 0x80;
+        max = (lead == 0xF4) ? 0x8F : 0xBF;
+    }
+    else
+    {
+        *skip = 1;
+        return 0;
+    }
+
+    /* Maximal valid prefix is replaced as a whole */
+    for (uint8_t i = 1; i < count; i++)
+    {
+        const uint8_t byte = (position + i < length) ? (uint8_t)content[position + i] : 0;
+        if (byte < min || byte > max)
+        {
+            *skip = i;
+            return 0;
+        }
+
+        min = 0x80;
+        max = 0xBF;
+    }
+
+    return count;
+}
+
+size_t
+rdsparser_string_get_utf8(const rdsparser_string_t *string,
+                          char                     *output,
+                          size_t                    size)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    const uint8_t length = rdsparser_string_get_length(string);
+    const rdsparser_string_char_t *content = rdsparser_string_get_content(string);
+    const bool utf8 = (rdsparser_string_get_encoding(string) == RDSPARSER_STRING_ENCODING_UTF8);
+    size_t written = 0;
+
+    /* Reserve space for the terminating null */
+    size--;
+
+    for (uint8_t i = 0; i < length; i++)
+    {
+        size_t count;
+        if (utf8)
+        {
+            /* Only complete sequences are written, invalid ones become U+FFFD */
+            uint8_t skip = 0;
+            count = rdsparser_string_check_utf8(content, length, i, &skip);
+            if (count == 0)
+            {
+                count = rdsparser_string_encode_utf8(0xFFFD,
+                                                     output + written,
+                                                     size - written);
+                if (count == 0)
+                {
+                    break;
+                }
+
+                i += skip - 1;
+            }
+            else
+            {
+                if (count > size - written)
+                {
+                    break;
+                }
+
+                for (uint8_t j = 0; j < count; j++)
+                {
+                    output[written + j] = (char)content[i + j];
+                }
+
+                i += count - 1;
+            }
+        }
+        else
+        {
+            count = rdsparser_string_encode_utf8((uint32_t)content[i],
+                                                 output + written,
+                                                 size - written);
+            if (count == 0)
+            {
+                break;
+            }
+        }
+
+        written += count;
+    }
+
+    output[written] = '\0';
+    return written;
+}
@@ -17,7 +17,7 @@
 #ifndef RDSPARSER_STRING_H
 #define RDSPARSER_STRING_H
 
-void rdsparser_string_init(rdsparser_string_t *string, uint8_t size);
+void rdsparser_string_init(rdsparser_string_t *string, uint8_t size, rdsparser_string_encoding_t encoding);
 void rdsparser_string_clear(rdsparser_string_t *string);
 bool rdsparser_string_update(rdsparser_string_t *string, const char input[2], rdsparser_block_error_t info_error, rdsparser_block_error_t data_error, uint8_t position, bool progressive, bool allow_eol);
 
@@ -0,0 +1,337 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <librdsparser_private.h>
+#include "tmc.h"
+
+#define RDSPARSER_TMC_CI_NONE -1
+#define RDSPARSER_TMC_FREE_BITS 28
+#define RDSPARSER_TMC_LABEL_DURATION 0
+/* Keys use only 41 bits, so no message matches an empty slot */
+#define RDSPARSER_TMC_KEY_EMPTY UINT64_MAX
+
+/* Content size of each ALERT-C optional label, in bits */
+static const uint8_t rdsparser_tmc_label_size[16] =
+{
+    3, 3, 5, 5, 5, 8, 8, 8, 8, 11, 16, 16, 16, 16, 0, 0
+};
+
+static inline bool
+rdsparser_tmc_get_tuning(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_B] & 0x10) >> 4;
+}
+
+static inline bool
+rdsparser_tmc_get_single(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_B] & 0x08) >> 3;
+}
+
+static inline uint8_t
+rdsparser_tmc_get_dp_ci(const rdsparser_data_t data)
+{
+    /* Duration and persistence (single group)
+       or continuity index (multi group) */
+    return data[RDSPARSER_BLOCK_B] & 0x07;
+}
+
+static inline bool
+rdsparser_tmc_get_diversion(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] & 0x8000) >> 15;
+}
+
+static inline bool
+rdsparser_tmc_get_first(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] & 0x8000) >> 15;
+}
+
+static inline bool
+rdsparser_tmc_get_direction(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] & 0x4000) >> 14;
+}
+
+static inline uint8_t
+rdsparser_tmc_get_extent(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] & 0x3800) >> 11;
+}
+
+static inline uint16_t
+rdsparser_tmc_get_event(const rdsparser_data_t data)
+{
+    return data[RDSPARSER_BLOCK_C] & 0x07FF;
+}
+
+static inline uint16_t
+rdsparser_tmc_get_location(const rdsparser_data_t data)
+{
+    return data[RDSPARSER_BLOCK_D];
+}
+
+static inline bool
+rdsparser_tmc_get_second(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] & 0x4000) >> 14;
+}
+
+static inline uint8_t
+rdsparser_tmc_get_gsi(const rdsparser_data_t data)
+{
+    return (data[RDSPARSER_BLOCK_C] & 0x3000) >> 12;
+}
+
+static inline uint32_t
+rdsparser_tmc_get_free(const rdsparser_data_t data)
+{
+    return ((uint32_t)(data[RDSPARSER_BLOCK_C] & 0x0FFF) << 16) | data[RDSPARSER_BLOCK_D];
+}
+
+static inline uint64_t
+rdsparser_tmc_get_key(const rdsparser_tmc_message_t *message)
+{
+    return ((uint64_t)message->location << 18) |
+           ((uint64_t)message->event << 7) |
+           ((uint64_t)message->direction << 6) |
+           ((uint64_t)message->extent << 3) |
+           message->duration;
+}
+
+static inline uint8_t
+rdsparser_tmc_get_hash(uint64_t key)
+{
+    const uint32_t folded = (uint32_t)(key ^ (key >> 32));
+    return (uint8_t)((folded * 2654435761u) >> (32 - RDSPARSER_TMC_HASH_BITS));
+}
+
+static uint8_t
+rdsparser_tmc_get_free_duration(const uint32_t *free,
+                                uint8_t         count)
+{
+    const uint8_t total = count * RDSPARSER_TMC_FREE_BITS;
+    uint8_t position = 0;
+
+    while (position + 4 <= total)
+    {
+        uint8_t label = 0;
+        for (uint8_t i = 0; i < 4; i++, position++)
+        {
+            label = (label << 1) | ((free[position / RDSPARSER_TMC_FREE_BITS] >> (RDSPARSER_TMC_FREE_BITS - 1 - position % RDSPARSER_TMC_FREE_BITS)) & 1);
+        }
+
+        const uint8_t size = rdsparser_tmc_label_size[label];
+        if (position + size > total)
+        {
+            break;
+        }
+
+        if (label == RDSPARSER_TMC_LABEL_DURATION)
+        {
+            uint8_t duration = 0;
+            for (uint8_t i = 0; i < size; i++, position++)
+            {
+                duration = (duration << 1) | ((free[position / RDSPARSER_TMC_FREE_BITS] >> (RDSPARSER_TMC_FREE_BITS - 1 - position % RDSPARSER_TMC_FREE_BITS)) & 1);
+            }
+
+            return duration;
+        }
+
+        position += size;
+    }
+
+    return 0;
+}
+
+static void
+rdsparser_tmc_add(rdsparser_t                   *rds,
+                  const rdsparser_tmc_message_t *message)
+{
+    if (rdsparser_tmc_push(&rds->tmc, message, rds->groups, rds->tmc_window) &&
+        rds->handlers->tmc)
+    {
+        rds->handlers->tmc(rds, rds->user_data);
+    }
+}
+
+static void
+rdsparser_tmc_parse_multi(rdsparser_t            *rds,
+                          const rdsparser_data_t  data)
+{
+    rdsparser_tmc_t *tmc = &rds->tmc;
+    const int8_t ci = rdsparser_tmc_get_dp_ci(data);
+
+    if (rdsparser_tmc_get_first(data))
+    {
+        tmc->ci = ci;
+        tmc->gsi = 0;
+        tmc->free_count = 0;
+        tmc->pending.event = rdsparser_tmc_get_event(data);
+        tmc->pending.location = rdsparser_tmc_get_location(data);
+        tmc->pending.extent = rdsparser_tmc_get_extent(data);
+        tmc->pending.direction = rdsparser_tmc_get_direction(data);
+        tmc->pending.diversion = false;
+        tmc->pending.duration = 0;
+        tmc->pending.multi_group = true;
+        return;
+    }
+
+    if (ci != tmc->ci)
+    {
+        return;
+    }
+
+    const uint8_t gsi = rdsparser_tmc_get_gsi(data);
+    if (rdsparser_tmc_get_second(data))
+    {
+        tmc->free_count = 0;
+    }
+    else if (tmc->free_count == 0 ||
+             gsi + 1 != tmc->gsi)
+    {
+        /* Missing group in a sequence */
+        tmc->ci = RDSPARSER_TMC_CI_NONE;
+        return;
+    }
+
+    tmc->gsi = gsi;
+    tmc->free[tmc->free_count++] = rdsparser_tmc_get_free(data);
+
+    if (gsi == 0)
+    {
+        tmc->pending.duration = rdsparser_tmc_get_free_duration(tmc->free, tmc->free_count);
+        tmc->ci = RDSPARSER_TMC_CI_NONE;
+        rdsparser_tmc_add(rds, &tmc->pending);
+    }
+    else if (tmc->free_count == RDSPARSER_TMC_FREE_COUNT)
+    {
+        tmc->ci = RDSPARSER_TMC_CI_NONE;
+    }
+}
+
+void
+rdsparser_tmc_clear(rdsparser_tmc_t *tmc)
+{
+    for (uint8_t i = 0; i < RDSPARSER_TMC_HASH_SIZE; i++)
+    {
+        tmc->hash[i] = RDSPARSER_TMC_KEY_EMPTY;
+        tmc->seen[i] = 0;
+    }
+
+    tmc->head = 0;
+    tmc->tail = 0;
+    tmc->overflow = 0;
+    tmc->ci = RDSPARSER_TMC_CI_NONE;
+    tmc->last_b = 0;
+    tmc->last_c = 0;
+    tmc->last_d = 0;
+}
+
+void
+rdsparser_tmc_parse(rdsparser_t             *rds,
+                    const rdsparser_data_t   data,
+                    const rdsparser_error_t  errors)
+{
+    if (errors[RDSPARSER_BLOCK_B] != 0 ||
+        errors[RDSPARSER_BLOCK_C] != 0 ||
+        errors[RDSPARSER_BLOCK_D] != 0 ||
+        rdsparser_tmc_get_tuning(data))
+    {
+        return;
+    }
+
+    const uint8_t tmc_b = data[RDSPARSER_BLOCK_B] & 0x1F;
+
+    if (rds->tmc.last_b == tmc_b &&
+        rds->tmc.last_c == data[RDSPARSER_BLOCK_C] &&
+        rds->tmc.last_d == data[RDSPARSER_BLOCK_D])
+    {
+        /* Groups are usually transmitted twice in a row */
+        return;
+    }
+
+    rds->tmc.last_b = tmc_b;
+    rds->tmc.last_c = data[RDSPARSER_BLOCK_C];
+    rds->tmc.last_d = data[RDSPARSER_BLOCK_D];
+
+    if (!rdsparser_tmc_get_single(data))
+    {
+        rdsparser_tmc_parse_multi(rds, data);
+        return;
+    }
+
+    rdsparser_tmc_message_t message;
+    message.event = rdsparser_tmc_get_event(data);
+    message.location = rdsparser_tmc_get_location(data);
+    message.extent = rdsparser_tmc_get_extent(data);
+    message.duration = rdsparser_tmc_get_dp_ci(data);
+    message.direction = rdsparser_tmc_get_direction(data);
+    message.diversion = rdsparser_tmc_get_diversion(data);
+    message.multi_group = false;
+    rdsparser_tmc_add(rds, &message);
+}
+
+bool
+rdsparser_tmc_push(rdsparser_tmc_t               *tmc,
+                   const rdsparser_tmc_message_t *message,
+                   uint32_t                       groups,
+                   uint32_t                       window)
+{
+    const uint64_t key = rdsparser_tmc_get_key(message);
+    const uint8_t hash = rdsparser_tmc_get_hash(key);
+    const bool repeated = (tmc->hash[hash] == key &&
+                           groups - tmc->seen[hash] <= window);
+
+    /* Each repeat keeps the message alive, so it expires only
+       after it was not broadcast for the whole window
+       (e.g. cancelled and later issued again) */
+    tmc->hash[hash] = key;
+    tmc->seen[hash] = groups;
+
+    if (repeated)
+    {
+        return false;
+    }
+
+    if ((uint8_t)(tmc->head - tmc->tail) == RDSPARSER_TMC_QUEUE_SIZE)
+    {
+        /* Queue is full, drop the oldest message */
+        tmc->tail++;
+        tmc->overflow++;
+    }
+
+    tmc->queue[tmc->head++ % RDSPARSER_TMC_QUEUE_SIZE] = *message;
+    return true;
+}
+
+size_t
+rdsparser_tmc_drain(rdsparser_t             *rds,
+                    rdsparser_tmc_message_t *out,
+                    size_t                   cap)
+{
+    rdsparser_tmc_t *tmc = &rds->tmc;
+    size_t count = 0;
+
+    while (count < cap &&
+           tmc->tail != tmc->head)
+    {
+        out[count++] = tmc->queue[tmc->tail++ % RDSPARSER_TMC_QUEUE_SIZE];
+    }
+
+    return count;
+}
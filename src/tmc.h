@@ -0,0 +1,28 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_TMC_H
+#define RDSPARSER_TMC_H
+#include <librdsparser_private.h>
+
+#define RDSPARSER_TMC_AID       0xCD46
+#define RDSPARSER_TMC_AID_ALT   0xCD47
+
+void rdsparser_tmc_clear(rdsparser_tmc_t *tmc);
+void rdsparser_tmc_parse(rdsparser_t *rds, const rdsparser_data_t data, const rdsparser_error_t errors);
+bool rdsparser_tmc_push(rdsparser_tmc_t *tmc, const rdsparser_tmc_message_t *message, uint32_t groups, uint32_t window);
+
+#endif
\ No newline at end of file
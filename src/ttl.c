@@ -0,0 +1,90 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdint.h>
+#include <librdsparser_private.h>
+#include "ttl.h"
+
+void
+rdsparser_ttl_clear(rdsparser_ttl_t *ttl)
+{
+    for (uint8_t i = 0; i < RDSPARSER_FIELD_COUNT; i++)
+    {
+        ttl->last_seen[i] = 0;
+    }
+
+    ttl->deadline = RDSPARSER_TTL_DEADLINE_NONE;
+}
+
+void
+rdsparser_ttl_set(rdsparser_ttl_t   *ttl,
+                  rdsparser_field_t  field,
+                  uint32_t           value)
+{
+    ttl->ttl[field] = value;
+    /* Recalculate the deadline on the next check */
+    ttl->deadline = 0;
+}
+
+void
+rdsparser_ttl_touch(rdsparser_ttl_t   *ttl,
+                    rdsparser_field_t  field,
+                    uint64_t           now)
+{
+    ttl->last_seen[field] = now;
+
+    if (ttl->ttl[field] &&
+        now + ttl->ttl[field] < ttl->deadline)
+    {
+        ttl->deadline = now + ttl->ttl[field];
+    }
+}
+
+uint32_t
+rdsparser_ttl_check(rdsparser_ttl_t *ttl,
+                    uint64_t         now)
+{
+    /* Fields are only scanned once the earliest deadline has passed,
+       a refreshed field just moves its own deadline further away */
+    if (now < ttl->deadline)
+    {
+        return 0;
+    }
+
+    uint64_t deadline = RDSPARSER_TTL_DEADLINE_NONE;
+    uint32_t expired = 0;
+
+    for (uint8_t i = 0; i < RDSPARSER_FIELD_COUNT; i++)
+    {
+        if (!ttl->ttl[i])
+        {
+            continue;
+        }
+
+        const uint64_t expiry = ttl->last_seen[i] + ttl->ttl[i];
+        if (now >= expiry)
+        {
+            expired |= (1U << i);
+        }
+        else if (expiry < deadline)
+        {
+            deadline = expiry;
+        }
+    }
+
+    ttl->deadline = deadline;
+    return expired;
+}
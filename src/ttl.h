@@ -0,0 +1,29 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#ifndef RDSPARSER_TTL_H
+#define RDSPARSER_TTL_H
+#include <stdint.h>
+#include <librdsparser_private.h>
+
+#define RDSPARSER_TTL_DEADLINE_NONE UINT64_MAX
+
+void rdsparser_ttl_clear(rdsparser_ttl_t *ttl);
+void rdsparser_ttl_set(rdsparser_ttl_t *ttl, rdsparser_field_t field, uint32_t value);
+void rdsparser_ttl_touch(rdsparser_ttl_t *ttl, rdsparser_field_t field, uint64_t now);
+uint32_t rdsparser_ttl_check(rdsparser_ttl_t *ttl, uint64_t now);
+
+#endif
@@ -18,17 +18,46 @@
 #include <string.h>
 #include <librdsparser_private.h>
 
+#define RDSPARSER_UTILS_HEX_VALID 0x10
+
+/* Hexadecimal digit value with a validity flag, zero for other characters */
+static const uint8_t rdsparser_utils_hex[256] =
+{
+    ['0'] = 0x10, ['1'] = 0x11, ['2'] = 0x12, ['3'] = 0x13,
+    ['4'] = 0x14, ['5'] = 0x15, ['6'] = 0x16, ['7'] = 0x17,
+    ['8'] = 0x18, ['9'] = 0x19,
+    ['A'] = 0x1A, ['B'] = 0x1B, ['C'] = 0x1C, ['D'] = 0x1D, ['E'] = 0x1E, ['F'] = 0x1F,
+    ['a'] = 0x1A, ['b'] = 0x1B, ['c'] = 0x1C, ['d'] = 0x1D, ['e'] = 0x1E, ['f'] = 0x1F
+};
+
+static inline bool
+rdsparser_utils_convert_hex(const char *input,
+                            uint8_t     count,
+                            uint16_t   *output)
+{
+    uint8_t valid = RDSPARSER_UTILS_HEX_VALID;
+    uint16_t value = 0;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const uint8_t digit = rdsparser_utils_hex[(uint8_t)input[i]];
+        valid &= digit;
+        value = (uint16_t)((value << 4) | (digit & 0x0F));
+    }
+
+    *output = value;
+    return (valid != 0);
+}
+
 bool
-rdsparser_utils_convert(const char        *input,
-                        rdsparser_data_t   data_out,
-                        rdsparser_error_t  errors_out)
+rdsparser_utils_convert_length(const char        *input,
+                               size_t             input_len,
+                               rdsparser_data_t   data_out,
+                               rdsparser_error_t  errors_out)
 {
     const size_t block_string_length = 4;
     const size_t error_string_length = 2;
-
     const size_t rds_len = RDSPARSER_BLOCK_COUNT * block_string_length;
-    const size_t input_len = strlen(input);
-    char *end;
 
     if (input_len == rds_len)
     {
@@ -39,10 +68,8 @@ rdsparser_utils_convert(const char        *input,
     }
     else if (input_len == rds_len + error_string_length)
     {
-        const char *ptr = input + RDSPARSER_BLOCK_COUNT * block_string_length;
-        uint8_t buffer = (uint8_t)strtol(ptr, &end, 16);
-
-        if (*end != '\0')
+        uint16_t buffer;
+        if (!rdsparser_utils_convert_hex(input + rds_len, error_string_length, &buffer))
         {
             return false;
         }
@@ -59,16 +86,9 @@ rdsparser_utils_convert(const char        *input,
 
     for (uint8_t block = 0; block < RDSPARSER_BLOCK_COUNT; block++)
     {
-        char buffer[block_string_length + 1];
-        for (uint8_t i = 0; i < block_string_length; i++)
-        {
-            buffer[i] = input[block * block_string_length + i];
-        }
-
-        buffer[block_string_length] = '\0';
-        data_out[block] = (uint16_t)strtol(buffer, &end, 16);
-
-        if (*end != '\0')
+        if (!rdsparser_utils_convert_hex(input + block * block_string_length,
+                                         block_string_length,
+                                         &data_out[block]))
         {
             return false;
         }
@@ -76,3 +96,11 @@ rdsparser_utils_convert(const char        *input,
 
     return true;
 }
+
+bool
+rdsparser_utils_convert(const char        *input,
+                        rdsparser_data_t   data_out,
+                        rdsparser_error_t  errors_out)
+{
+    return rdsparser_utils_convert_length(input, strlen(input), data_out, errors_out);
+}
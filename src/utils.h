@@ -18,6 +18,7 @@
 #define RDSPARSER_UTILS_H
 #include <librdsparser_private.h>
 
+bool rdsparser_utils_convert_length(const char *input, size_t input_len, rdsparser_data_t data_out, rdsparser_error_t errors_out);
 bool rdsparser_utils_convert(const char *input, rdsparser_data_t data_out, rdsparser_error_t errors_out);
 
 #endif
\ No newline at end of file
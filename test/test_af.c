@@ -25,6 +25,7 @@
 
 typedef struct {
     rdsparser_af_t af;
+    rdsparser_af_table_t table;
 } test_context_t;
 
 static int
@@ -48,6 +49,9 @@ test_setup(void **state)
 {
     test_context_t *ctx = *state;
     rdsparser_af_clear(&ctx->af);
+#ifndef RDSPARSER_DISABLE_AF
+    rdsparser_af_table_clear(&ctx->table);
+#endif
     return 0;
 }
 
@@ -84,11 +88,11 @@ af_test_set_one_frequency(void **state)
     rdsparser_af_set(&ctx->af, id);
     assert_int_equal(rdsparser_af_get(&ctx->af, id), true);
 
-    for (uint8_t i = 0; i < RDSPARSER_AF_BUFFER_SIZE; i++)
+    for (uint8_t i = 0; i < RDSPARSER_AF_BITMAP_WORDS; i++)
     {
-        if (i == (id / 8))
+        if (i == (id / 64))
         {
-            assert_int_equal(ctx->af.buffer[i], 0x80 >> (id % 8));
+            assert_int_equal(ctx->af.buffer[i], (uint64_t)1 << (id % 64));
         }
         else
         {
@@ -118,7 +122,7 @@ af_test_set_invalid_0(void **state)
     const uint8_t id = 0;
     assert_int_equal(rdsparser_af_set(&ctx->af, id), false);
 
-    for (uint8_t i = 0; i < RDSPARSER_AF_BUFFER_SIZE; i++)
+    for (uint8_t i = 0; i < RDSPARSER_AF_BITMAP_WORDS; i++)
     {
         assert_int_equal(ctx->af.buffer[i], 0);
     }
@@ -134,19 +138,158 @@ af_test_set_invalid(void **state)
         assert_int_equal(rdsparser_af_set(&ctx->af, id), false);
     }
 
-    for (uint8_t i = 0; i < RDSPARSER_AF_BUFFER_SIZE; i++)
+    for (uint8_t i = 0; i < RDSPARSER_AF_BITMAP_WORDS; i++)
     {
         assert_int_equal(ctx->af.buffer[i], 0);
     }
 }
 
+static void
+af_test_count(void **state)
+{
+    test_context_t *ctx = *state;
+
+    assert_int_equal(rdsparser_af_count(&ctx->af), 0);
+    rdsparser_af_set(&ctx->af, 1);
+    rdsparser_af_set(&ctx->af, 63);
+    rdsparser_af_set(&ctx->af, 64);
+    rdsparser_af_set(&ctx->af, 204);
+    assert_int_equal(rdsparser_af_count(&ctx->af), 4);
+    rdsparser_af_set(&ctx->af, 64);
+    assert_int_equal(rdsparser_af_count(&ctx->af), 4);
+
+    for (uint8_t i = 1; i <= 204; i++)
+    {
+        rdsparser_af_set(&ctx->af, i);
+    }
+    assert_int_equal(rdsparser_af_count(&ctx->af), 204);
+}
+
+static void
+af_test_next(void **state)
+{
+    test_context_t *ctx = *state;
+
+    assert_int_equal(rdsparser_af_next(&ctx->af, 0), 0);
+    rdsparser_af_set(&ctx->af, 1);
+    rdsparser_af_set(&ctx->af, 63);
+    rdsparser_af_set(&ctx->af, 64);
+    rdsparser_af_set(&ctx->af, 204);
+
+    assert_int_equal(rdsparser_af_next(&ctx->af, 0), 87600);
+    assert_int_equal(rdsparser_af_next(&ctx->af, 87600), 93800);
+    assert_int_equal(rdsparser_af_next(&ctx->af, 93800), 93900);
+    assert_int_equal(rdsparser_af_next(&ctx->af, 93900), 107900);
+    assert_int_equal(rdsparser_af_next(&ctx->af, 107900), 0);
+    assert_int_equal(rdsparser_af_next(&ctx->af, 93850), 93900);
+    assert_int_equal(rdsparser_af_next(&ctx->af, 110000), 0);
+}
+
+static void
+af_test_to_array(void **state)
+{
+    test_context_t *ctx = *state;
+    uint32_t khz[RDSPARSER_AF_BITMAP_WORDS * 64];
+
+    assert_int_equal(rdsparser_af_to_array(&ctx->af, khz, 25), 0);
+    rdsparser_af_set(&ctx->af, 204);
+    rdsparser_af_set(&ctx->af, 128);
+    rdsparser_af_set(&ctx->af, 5);
+
+    assert_int_equal(rdsparser_af_to_array(&ctx->af, khz, 25), 3);
+    assert_int_equal(khz[0], 88000);
+    assert_int_equal(khz[1], 100300);
+    assert_int_equal(khz[2], 107900);
+
+    khz[1] = 0;
+    assert_int_equal(rdsparser_af_to_array(&ctx->af, khz, 1), 1);
+    assert_int_equal(khz[0], 88000);
+    assert_int_equal(khz[1], 0);
+    assert_int_equal(rdsparser_af_to_array(&ctx->af, khz, 0), 0);
+}
+
+static void
+af_test_unset(void **state)
+{
+    test_context_t *ctx = *state;
+
+    assert_int_equal(rdsparser_af_unset(&ctx->af, 100), false);
+    rdsparser_af_set(&ctx->af, 100);
+    rdsparser_af_set(&ctx->af, 101);
+    assert_int_equal(rdsparser_af_unset(&ctx->af, 100), true);
+    assert_int_equal(rdsparser_af_get(&ctx->af, 100), false);
+    assert_int_equal(rdsparser_af_get(&ctx->af, 101), true);
+    assert_int_equal(rdsparser_af_unset(&ctx->af, 0), false);
+    assert_int_equal(rdsparser_af_unset(&ctx->af, 205), false);
+}
+
+static void
+af_test_get_value(void **state)
+{
+    assert_int_equal(rdsparser_af_get_value(87600), 1);
+    assert_int_equal(rdsparser_af_get_value(107900), 204);
+    assert_int_equal(rdsparser_af_get_value(87500), 0);
+    assert_int_equal(rdsparser_af_get_value(108000), 0);
+    assert_int_equal(rdsparser_af_get_value(98150), 0);
+    assert_int_equal(rdsparser_af_get_value(0), 0);
+}
+
+#ifndef RDSPARSER_DISABLE_AF
+static void
+af_test_table_hit(void **state)
+{
+    test_context_t *ctx = *state;
+
+    rdsparser_af_table_hit(&ctx->table, 10, 1000);
+    rdsparser_af_table_hit(&ctx->table, 10, 2000);
+    assert_int_equal(ctx->table.hits[10], 2);
+    assert_int_equal(ctx->table.last_seen[10], 2000);
+
+    rdsparser_af_table_hit(&ctx->table, 0, 3000);
+    rdsparser_af_table_hit(&ctx->table, 205, 3000);
+    assert_int_equal(ctx->table.hits[0], 0);
+
+    ctx->table.hits[20] = UINT16_MAX;
+    rdsparser_af_table_hit(&ctx->table, 20, 3000);
+    assert_int_equal(ctx->table.hits[20], UINT16_MAX);
+}
+
+static void
+af_test_table_expired(void **state)
+{
+    test_context_t *ctx = *state;
+
+    rdsparser_af_table_hit(&ctx->table, 10, 1000);
+    assert_int_equal(rdsparser_af_table_expired(&ctx->table, 10, 1500, 500), false);
+    assert_int_equal(rdsparser_af_table_expired(&ctx->table, 10, 1501, 500), true);
+
+    /* Ticks above 32 bits */
+    rdsparser_af_table_hit(&ctx->table, 11, (uint64_t)UINT32_MAX - 100);
+    assert_int_equal(rdsparser_af_table_expired(&ctx->table, 11, (uint64_t)UINT32_MAX + 400, 500), false);
+    assert_int_equal(rdsparser_af_table_expired(&ctx->table, 11, (uint64_t)UINT32_MAX + 401, 500), true);
+    assert_int_equal(rdsparser_af_table_expired(&ctx->table, 11, (uint64_t)UINT32_MAX * 2, 500), true);
+
+    /* Time set back */
+    assert_int_equal(rdsparser_af_table_expired(&ctx->table, 11, 100, 500), false);
+}
+#endif
+
 const struct CMUnitTest tests[] =
 {
     cmocka_unit_test_setup_teardown(af_test_set_each_frequency, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(af_test_set_one_frequency, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(af_test_set_clear, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(af_test_set_invalid_0, test_setup, test_teardown),
-    cmocka_unit_test_setup_teardown(af_test_set_invalid, test_setup, test_teardown)
+    cmocka_unit_test_setup_teardown(af_test_set_invalid, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_count, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_next, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_to_array, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_unset, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_get_value, test_setup, test_teardown),
+#ifndef RDSPARSER_DISABLE_AF
+    cmocka_unit_test_setup_teardown(af_test_table_hit, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_table_expired, test_setup, test_teardown)
+#endif
 };
 
 int
@@ -75,7 +75,7 @@ buffer_test_clear(void **state)
     assert_int_equal(rdsparser_buffer_get_country(&ctx->buffer), RDSPARSER_COUNTRY_UNKNOWN);
 
     const rdsparser_af_t *af = rdsparser_buffer_get_af(&ctx->buffer);
-    for (uint8_t i = 0; i < RDSPARSER_AF_BUFFER_SIZE; i++)
+    for (uint8_t i = 0; i < RDSPARSER_AF_BITMAP_WORDS; i++)
     {
         assert_int_equal(af->buffer[i], 0);
     }
@@ -391,6 +391,20 @@ buffer_test_add_af_extended_check(void **state)
     assert_int_equal(rdsparser_af_get(af, 52), true);
 }
 
+static void
+buffer_test_remove_af(void **state)
+{
+    test_context_t *ctx = *state;
+    const rdsparser_af_t *af = rdsparser_buffer_get_af(&ctx->buffer);
+
+    assert_int_equal(rdsparser_buffer_remove_af(&ctx->buffer, 123), false);
+    assert_int_equal(rdsparser_buffer_add_af(&ctx->buffer, 123), true);
+    assert_int_equal(rdsparser_buffer_remove_af(&ctx->buffer, 123), true);
+    assert_int_equal(rdsparser_af_get(af, 123), false);
+    assert_int_equal(rdsparser_buffer_remove_af(&ctx->buffer, 123), false);
+    assert_int_equal(rdsparser_buffer_add_af(&ctx->buffer, 123), true);
+}
+
 const struct CMUnitTest tests[] =
 {
     cmocka_unit_test_setup_teardown(buffer_test_clear, test_setup, test_teardown),
@@ -410,7 +424,8 @@ const struct CMUnitTest tests[] =
     cmocka_unit_test_setup_teardown(buffer_test_update_country, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(buffer_test_update_country_extended_check, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(buffer_test_add_af, test_setup, test_teardown),
-    cmocka_unit_test_setup_teardown(buffer_test_add_af_extended_check, test_setup, test_teardown)
+    cmocka_unit_test_setup_teardown(buffer_test_add_af_extended_check, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(buffer_test_remove_af, test_setup, test_teardown)
 };
 
 int
@@ -0,0 +1,125 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "charset.c"
+
+static void
+charset_test_lookup_classes(void **state)
+{
+    for (uint8_t charset = 0; charset <= RDSPARSER_CHARSET_RAW; charset++)
+    {
+        for (uint16_t input = 0; input < 256; input++)
+        {
+            const uint16_t entry = rdsparser_charset_lookup(charset, (uint8_t)input);
+            rdsparser_charset_class_t expected;
+
+            if (input == '\r')
+            {
+                expected = RDSPARSER_CHARSET_CLASS_EOL;
+            }
+            else if (input < 0x20)
+            {
+                expected = RDSPARSER_CHARSET_CLASS_INVALID;
+            }
+            else if (input < 0x7F)
+            {
+                expected = RDSPARSER_CHARSET_CLASS_BASIC;
+            }
+            else
+            {
+                expected = RDSPARSER_CHARSET_CLASS_SPECIAL;
+            }
+
+            assert_int_equal(RDSPARSER_CHARSET_CLASS(entry), expected);
+        }
+    }
+}
+
+static void
+charset_test_lookup_eol(void **state)
+{
+    assert_int_equal(RDSPARSER_CHARSET_CODE(rdsparser_charset_lookup(RDSPARSER_CHARSET_G0, '\r')), 0);
+    assert_int_equal(RDSPARSER_CHARSET_CODE(rdsparser_charset_lookup(RDSPARSER_CHARSET_RAW, '\r')), 0);
+}
+
+static void
+charset_test_lookup_g0(void **state)
+{
+    assert_int_equal(RDSPARSER_CHARSET_CODE(rdsparser_charset_lookup(RDSPARSER_CHARSET_G0, 'A')), 'A');
+    assert_int_equal(RDSPARSER_CHARSET_CODE(rdsparser_charset_lookup(RDSPARSER_CHARSET_G0, 0x24)), 0x00A4);
+    assert_int_equal(RDSPARSER_CHARSET_CODE(rdsparser_charset_lookup(RDSPARSER_CHARSET_G0, 0xA9)), 0x20AC);
+    assert_int_equal(RDSPARSER_CHARSET_CODE(rdsparser_charset_lookup(RDSPARSER_CHARSET_G0, 0xF2)), 0x00E6);
+}
+
+static void
+charset_test_lookup_g0_reference(void **state)
+{
+    /* One code point of every column of the G0 table */
+    const uint16_t reference[][2] =
+    {
+        { 0x20, 0x0020 }, { 0x3F, 0x003F }, { 0x40, 0x0040 }, { 0x5E, 0x2015 },
+        { 0x60, 0x2016 }, { 0x7E, 0x00AF }, { 0x80, 0x00E1 }, { 0x8D, 0x03B2 },
+        { 0x9F, 0x0133 }, { 0xA1, 0x03B1 }, { 0xA8, 0x03C0 }, { 0xAF, 0x2193 },
+        { 0xB5, 0x0130 }, { 0xBF, 0x00A7 }, { 0xCA, 0x0158 }, { 0xDF, 0x0140 },
+        { 0xE9, 0x014A }, { 0xFE, 0x0167 }
+    };
+
+    for (size_t i = 0; i < sizeof(reference) / sizeof(reference[0]); i++)
+    {
+        const uint16_t entry = rdsparser_charset_lookup(RDSPARSER_CHARSET_G0, (uint8_t)reference[i][0]);
+        assert_int_equal(RDSPARSER_CHARSET_CODE(entry), reference[i][1]);
+    }
+}
+
+static void
+charset_test_lookup_raw(void **state)
+{
+    assert_int_equal(RDSPARSER_CHARSET_CODE(rdsparser_charset_lookup(RDSPARSER_CHARSET_RAW, 0x24)), 0x24);
+    assert_int_equal(RDSPARSER_CHARSET_CODE(rdsparser_charset_lookup(RDSPARSER_CHARSET_RAW, 0xC3)), 0xC3);
+}
+
+static void
+charset_test_is_switch(void **state)
+{
+    assert_true(rdsparser_charset_is_switch("\x0E\x0E"));
+    assert_true(rdsparser_charset_is_switch("\x1B\x6E"));
+    assert_true(rdsparser_charset_is_switch("\x0F\x0F"));
+    assert_false(rdsparser_charset_is_switch("\x0E\x0F"));
+    assert_false(rdsparser_charset_is_switch("AB"));
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(charset_test_lookup_classes, NULL, NULL),
+    cmocka_unit_test_setup_teardown(charset_test_lookup_eol, NULL, NULL),
+    cmocka_unit_test_setup_teardown(charset_test_lookup_g0, NULL, NULL),
+    cmocka_unit_test_setup_teardown(charset_test_lookup_g0_reference, NULL, NULL),
+    cmocka_unit_test_setup_teardown(charset_test_lookup_raw, NULL, NULL),
+    cmocka_unit_test_setup_teardown(charset_test_is_switch, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
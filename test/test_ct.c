@@ -72,6 +72,22 @@ af_test_ct(void **state)
     assert_int_equal(rdsparser_ct_get_offset(&ctx->ct), 0);
 }
 
+static void
+af_test_ct_date(void **state)
+{
+    test_context_t *ctx = *state;
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+
+    /* 23:30 UTC, next day in CET */
+    assert_int_equal(rdsparser_ct_init(&ctx->ct, 60369, 23, 30, 2), true);
+    rdsparser_ct_get_date(&ctx->ct, &year, &month, &day);
+    assert_int_equal(year, 2024);
+    assert_int_equal(month, 3);
+    assert_int_equal(day, 1);
+}
+
 static void
 af_test_ct_invalid_hour(void **state)
 {
@@ -190,9 +206,51 @@ af_test_ct_negative_day_and_hour_offset(void **state)
     assert_int_equal(rdsparser_ct_get_offset(&ctx->ct), -180);
 }
 
+static void
+af_test_ct_epoch(void **state)
+{
+    test_context_t *ctx = *state;
+    assert_int_equal(rdsparser_ct_init(&ctx->ct, 60328, 0, 6, 2), true);
+    assert_int_equal(rdsparser_ct_get_epoch(&ctx->ct), 1705622760);
+    assert_int_equal(rdsparser_ct_init(&ctx->ct, 40587, 0, 0, -4), true);
+    assert_int_equal(rdsparser_ct_get_epoch(&ctx->ct), 0);
+}
+
+static void
+af_test_ct_filter(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_ct_filter_t filter = {0};
+
+    /* The first time is only a candidate */
+    assert_int_equal(rdsparser_ct_init(&ctx->ct, 60328, 0, 6, 0), true);
+    assert_int_equal(rdsparser_ct_filter_check(&filter, &ctx->ct, 1000), false);
+
+    /* One minute later (685 groups) */
+    assert_int_equal(rdsparser_ct_init(&ctx->ct, 60328, 0, 7, 0), true);
+    assert_int_equal(rdsparser_ct_filter_check(&filter, &ctx->ct, 1685), true);
+
+    /* A day off */
+    assert_int_equal(rdsparser_ct_init(&ctx->ct, 60329, 0, 8, 0), true);
+    assert_int_equal(rdsparser_ct_filter_check(&filter, &ctx->ct, 2370), false);
+
+    /* The jump is confirmed by the next time */
+    assert_int_equal(rdsparser_ct_init(&ctx->ct, 60329, 0, 9, 0), true);
+    assert_int_equal(rdsparser_ct_filter_check(&filter, &ctx->ct, 3055), true);
+
+    /* Group counter wrap-around */
+    filter.groups = UINT32_MAX - 100;
+    assert_int_equal(rdsparser_ct_init(&ctx->ct, 60329, 0, 10, 0), true);
+    assert_int_equal(rdsparser_ct_filter_check(&filter, &ctx->ct, 584), true);
+
+    rdsparser_ct_filter_clear(&filter);
+    assert_int_equal(rdsparser_ct_filter_check(&filter, &ctx->ct, 584), false);
+}
+
 const struct CMUnitTest tests[] =
 {
     cmocka_unit_test_setup_teardown(af_test_ct, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_ct_date, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(af_test_ct_invalid_hour, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(af_test_ct_invalid_minute, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(af_test_ct_zero_offset, test_setup, test_teardown),
@@ -202,7 +260,9 @@ const struct CMUnitTest tests[] =
     cmocka_unit_test_setup_teardown(af_test_ct_positive_hour_offset, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(af_test_ct_negative_hour_offset, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(af_test_ct_positive_day_and_hour_offset, test_setup, test_teardown),
-    cmocka_unit_test_setup_teardown(af_test_ct_negative_day_and_hour_offset, test_setup, test_teardown)
+    cmocka_unit_test_setup_teardown(af_test_ct_negative_day_and_hour_offset, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_ct_epoch, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(af_test_ct_filter, test_setup, test_teardown)
 };
 
 int
@@ -0,0 +1,200 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "eon.c"
+
+static int
+test_setup(void **state)
+{
+    rdsparser_eon_table_t *table = malloc(sizeof(rdsparser_eon_table_t));
+    rdsparser_eon_table_init(table);
+    *state = table;
+    return 0;
+}
+
+static int
+test_teardown(void **state)
+{
+    free(*state);
+    return 0;
+}
+
+static void
+eon_test_table_empty(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    assert_int_equal(table->count, 0);
+    assert_true(rdsparser_eon_table_lookup(table, 0x3201) == NULL);
+}
+
+static void
+eon_test_table_insert(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    rdsparser_eon_t *eon = rdsparser_eon_table_insert(table, 0x3201);
+
+    assert_true(eon != NULL);
+    assert_int_equal(eon->pi, 0x3201);
+    assert_int_equal(eon->pty, RDSPARSER_PTY_UNKNOWN);
+    assert_int_equal(eon->tp, RDSPARSER_TP_UNKNOWN);
+    assert_int_equal(eon->ta, RDSPARSER_TA_UNKNOWN);
+    assert_int_equal(table->count, 1);
+    assert_true(rdsparser_eon_table_lookup(table, 0x3201) == eon);
+}
+
+static void
+eon_test_table_insert_existing(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    rdsparser_eon_t *eon = rdsparser_eon_table_insert(table, 0x3201);
+
+    assert_true(rdsparser_eon_table_insert(table, 0x3201) == eon);
+    assert_int_equal(table->count, 1);
+}
+
+static void
+eon_test_table_insert_collision(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    /* Both keys hash to the same slot */
+    rdsparser_eon_t *eon1 = rdsparser_eon_table_insert(table, 0x0001);
+    rdsparser_eon_t *eon2 = rdsparser_eon_table_insert(table, 0x0100);
+
+    assert_int_equal(rdsparser_eon_table_hash(0x0001), rdsparser_eon_table_hash(0x0100));
+    assert_true(eon1 != eon2);
+    assert_true(rdsparser_eon_table_lookup(table, 0x0001) == eon1);
+    assert_true(rdsparser_eon_table_lookup(table, 0x0100) == eon2);
+    assert_int_equal(table->order[0], eon1 - table->entry);
+    assert_int_equal(table->order[1], eon2 - table->entry);
+}
+
+static void
+eon_test_table_full(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+
+    for (uint16_t i = 0; i < RDSPARSER_EON_TABLE_SIZE; i++)
+    {
+        assert_true(rdsparser_eon_table_insert(table, 0x3200 + i) != NULL);
+    }
+
+    assert_int_equal(table->count, RDSPARSER_EON_TABLE_SIZE);
+    assert_true(rdsparser_eon_table_insert(table, 0x3300) == NULL);
+    assert_true(rdsparser_eon_table_lookup(table, 0x3300) == NULL);
+    assert_true(rdsparser_eon_table_lookup(table, 0x3207) != NULL);
+}
+
+static void
+eon_test_table_clear(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    rdsparser_eon_t *eon = rdsparser_eon_table_insert(table, 0x3201);
+    rdsparser_eon_add_af(eon, 1);
+
+    rdsparser_eon_table_clear(table);
+    assert_int_equal(table->count, 0);
+    assert_true(rdsparser_eon_table_lookup(table, 0x3201) == NULL);
+    assert_int_equal(eon->af.buffer[0], 0);
+}
+
+static void
+eon_test_update(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    rdsparser_eon_t *eon = rdsparser_eon_table_insert(table, 0x3201);
+
+    assert_int_equal(rdsparser_eon_update_pty(eon, 10), true);
+    assert_int_equal(rdsparser_eon_update_pty(eon, 10), false);
+    assert_int_equal(rdsparser_eon_update_tp(eon, true), true);
+    assert_int_equal(rdsparser_eon_update_tp(eon, true), false);
+    assert_int_equal(rdsparser_eon_update_ta(eon, false), true);
+    assert_int_equal(rdsparser_eon_update_ta(eon, false), false);
+}
+
+static void
+eon_test_add_af(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    rdsparser_eon_t *eon = rdsparser_eon_table_insert(table, 0x3201);
+
+    assert_int_equal(rdsparser_eon_add_af(eon, 1), true);
+    assert_int_equal(rdsparser_eon_add_af(eon, 1), false);
+    assert_int_equal(rdsparser_eon_add_af(eon, 205), false);
+    assert_int_equal(rdsparser_af_count(&eon->af), 1);
+}
+
+static void
+eon_test_add_mapping(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    rdsparser_eon_t *eon = rdsparser_eon_table_insert(table, 0x3201);
+
+    assert_int_equal(rdsparser_eon_add_mapping(eon, 10, 30), true);
+    assert_int_equal(rdsparser_eon_add_mapping(eon, 10, 30), false);
+    assert_int_equal(rdsparser_eon_get_mapped(eon, 88500), 90500);
+    assert_int_equal(rdsparser_eon_get_mapped(eon, 88600), 0);
+
+    assert_int_equal(rdsparser_eon_add_mapping(eon, 10, 31), true);
+    assert_int_equal(rdsparser_eon_get_mapped(eon, 88500), 90600);
+
+    assert_int_equal(rdsparser_eon_add_mapping(eon, 0, 31), false);
+    assert_int_equal(rdsparser_eon_add_mapping(eon, 10, 205), false);
+}
+
+static void
+eon_test_add_mapping_full(void **state)
+{
+    rdsparser_eon_table_t *table = *state;
+    rdsparser_eon_t *eon = rdsparser_eon_table_insert(table, 0x3201);
+
+    for (uint8_t i = 0; i <= RDSPARSER_EON_MAPPING_SIZE; i++)
+    {
+        assert_int_equal(rdsparser_eon_add_mapping(eon, 10 + i, 30 + i), true);
+    }
+
+    /* The oldest mapping is replaced */
+    assert_int_equal(rdsparser_eon_get_mapped(eon, 88500), 0);
+    assert_int_equal(rdsparser_eon_get_mapped(eon, 88600), 90600);
+    assert_int_equal(rdsparser_eon_get_mapped(eon, 88500 + RDSPARSER_EON_MAPPING_SIZE * 100),
+                     90500 + RDSPARSER_EON_MAPPING_SIZE * 100);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(eon_test_table_empty, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_table_insert, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_table_insert_existing, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_table_insert_collision, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_table_full, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_table_clear, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_update, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_add_af, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_add_mapping, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(eon_test_add_mapping_full, test_setup, test_teardown)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,54 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "ert.c"
+
+static void
+ert_test_get_pos_0(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xC5E0;
+
+    assert_int_equal(rdsparser_ert_get_pos(data), 0);
+}
+
+static void
+ert_test_get_pos_31(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xC5FF;
+
+    assert_int_equal(rdsparser_ert_get_pos(data), 31);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(ert_test_get_pos_0, NULL, NULL),
+    cmocka_unit_test_setup_teardown(ert_test_get_pos_31, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,82 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "event.c"
+
+static void
+event_test_ring(void **state)
+{
+    rdsparser_event_t buffer[RDSPARSER_EVENT_QUEUE_SIZE];
+    rdsparser_event_queue_t queue = { .event = buffer };
+
+    /* Indices wrap around the buffer */
+    queue.head = queue.tail = UINT32_MAX - 2;
+
+    for (uint32_t i = 0; i < RDSPARSER_EVENT_QUEUE_SIZE; i++)
+    {
+        const rdsparser_event_t event = { .type = RDSPARSER_EVENT_AF, .value = i };
+        assert_true(rdsparser_event_push(&queue, &event));
+    }
+
+    const rdsparser_event_t extra = { .type = RDSPARSER_EVENT_PI };
+    assert_false(rdsparser_event_push(&queue, &extra));
+    assert_false(rdsparser_event_push(&queue, &extra));
+    assert_int_equal(queue.overflow, 2);
+
+    for (uint32_t i = 0; i < RDSPARSER_EVENT_QUEUE_SIZE; i++)
+    {
+        const rdsparser_event_t *event = &queue.event[queue.tail++ % RDSPARSER_EVENT_QUEUE_SIZE];
+        assert_int_equal(event->type, RDSPARSER_EVENT_AF);
+        assert_int_equal(event->value, i);
+    }
+
+    assert_int_equal(queue.head, queue.tail);
+    assert_true(rdsparser_event_push(&queue, &extra));
+}
+
+static void
+event_test_range(void **state)
+{
+    rdsparser_event_queue_t queue;
+    rdsparser_event_clear_range(&queue);
+
+    assert_int_equal(queue.range[RDSPARSER_TEXT_RT][0], RDSPARSER_EVENT_RANGE_NONE);
+    rdsparser_event_range(&queue, RDSPARSER_TEXT_RT, 20);
+    rdsparser_event_range(&queue, RDSPARSER_TEXT_RT, 16);
+    rdsparser_event_range(&queue, RDSPARSER_TEXT_RT, 18);
+    assert_int_equal(queue.range[RDSPARSER_TEXT_RT][0], 16);
+    assert_int_equal(queue.range[RDSPARSER_TEXT_RT][1], 22);
+    assert_int_equal(queue.range[RDSPARSER_TEXT_PS][0], RDSPARSER_EVENT_RANGE_NONE);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(event_test_ring, NULL, NULL),
+    cmocka_unit_test_setup_teardown(event_test_range, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -59,6 +59,7 @@ group0_test_get_ms_false(void **state)
     assert_int_equal(rdsparser_group0_get_ms(data), false);
 }
 
+#ifndef RDSPARSER_DISABLE_AF
 static void
 group0_test_get_af1(void **state)
 {
@@ -78,6 +79,7 @@ group0_test_get_af2(void **state)
 
     assert_int_equal(rdsparser_group0a_get_af2(data), 0xA4);
 }
+#endif
 
 static void
 group0_test_get_ps_pos_0(void **state)
@@ -103,8 +105,10 @@ const struct CMUnitTest tests[] =
     cmocka_unit_test_setup_teardown(group0_test_get_ta_false, NULL, NULL),
     cmocka_unit_test_setup_teardown(group0_test_get_ms_true, NULL, NULL),
     cmocka_unit_test_setup_teardown(group0_test_get_ms_false, NULL, NULL),
+#ifndef RDSPARSER_DISABLE_AF
     cmocka_unit_test_setup_teardown(group0_test_get_af1, NULL, NULL),
     cmocka_unit_test_setup_teardown(group0_test_get_af2, NULL, NULL),
+#endif
     cmocka_unit_test_setup_teardown(group0_test_get_ps_pos_0, NULL, NULL),
     cmocka_unit_test_setup_teardown(group0_test_get_ps_pos_3, NULL, NULL)
 };
@@ -41,10 +41,41 @@ group1a0_test_get_ecc(void **state)
     assert_int_equal(rdsparser_group1a0_get_ecc(data), 0xE2);
 }
 
+static void
+group1a_test_get_la(void **state)
+{
+    rdsparser_data_t data;
+    data[2] = 0x80E2;
+
+    assert_int_equal(rdsparser_group1a_get_la(data), RDSPARSER_LA_ON);
+}
+
+static void
+group1a_test_get_slc(void **state)
+{
+    rdsparser_data_t data;
+    data[2] = 0xB00F;
+
+    assert_int_equal(rdsparser_group1a_get_variant(data), RDSPARSER_SLC_LANGUAGE);
+    assert_int_equal(rdsparser_group1a_get_slc(data), 0x00F);
+}
+
+static void
+group1_test_get_pin(void **state)
+{
+    rdsparser_data_t data;
+    data[3] = 0xA5C5;
+
+    assert_int_equal(rdsparser_group1_get_pin(data), 0xA5C5);
+}
+
 const struct CMUnitTest tests[] =
 {
     cmocka_unit_test_setup_teardown(group1a_test_get_variant, NULL, NULL),
-    cmocka_unit_test_setup_teardown(group1a0_test_get_ecc, NULL, NULL)
+    cmocka_unit_test_setup_teardown(group1a0_test_get_ecc, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group1a_test_get_la, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group1a_test_get_slc, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group1_test_get_pin, NULL, NULL)
 };
 
 int
@@ -0,0 +1,114 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "group14.c"
+
+static void
+group14_test_get_tp_on_true(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xE010;
+
+    assert_int_equal(rdsparser_group14_get_tp_on(data), true);
+}
+
+static void
+group14_test_get_tp_on_false(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xE7EF;
+
+    assert_int_equal(rdsparser_group14_get_tp_on(data), false);
+}
+
+static void
+group14_test_get_pi_on(void **state)
+{
+    rdsparser_data_t data;
+    data[3] = 0x3201;
+
+    assert_int_equal(rdsparser_group14_get_pi_on(data), 0x3201);
+}
+
+static void
+group14a_test_get_variant(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xE01D;
+
+    assert_int_equal(rdsparser_group14a_get_variant(data), 13);
+}
+
+static void
+group14a_test_get_pty_on(void **state)
+{
+    rdsparser_data_t data;
+    data[2] = 0x5001;
+
+    assert_int_equal(rdsparser_group14a_get_pty_on(data), 10);
+}
+
+static void
+group14a_test_get_ta_on(void **state)
+{
+    rdsparser_data_t data;
+    data[2] = 0x5001;
+
+    assert_int_equal(rdsparser_group14a_get_ta_on(data), true);
+}
+
+static void
+group14b_test_get_ta_on_true(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xE808;
+
+    assert_int_equal(rdsparser_group14b_get_ta_on(data), true);
+}
+
+static void
+group14b_test_get_ta_on_false(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xEFF7;
+
+    assert_int_equal(rdsparser_group14b_get_ta_on(data), false);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(group14_test_get_tp_on_true, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group14_test_get_tp_on_false, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group14_test_get_pi_on, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group14a_test_get_variant, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group14a_test_get_pty_on, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group14a_test_get_ta_on, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group14b_test_get_ta_on_true, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group14b_test_get_ta_on_false, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
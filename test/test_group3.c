@@ -0,0 +1,54 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "group3.c"
+
+static void
+group3a_test_get_app_group(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0x3016;
+
+    assert_int_equal(rdsparser_group3a_get_app_group(data), 0x16);
+}
+
+static void
+group3a_test_get_aid(void **state)
+{
+    rdsparser_data_t data;
+    data[3] = 0x4BD7;
+
+    assert_int_equal(rdsparser_group3a_get_aid(data), 0x4BD7);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(group3a_test_get_app_group, NULL, NULL),
+    cmocka_unit_test_setup_teardown(group3a_test_get_aid, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
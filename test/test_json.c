@@ -0,0 +1,99 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "json.c"
+
+static void
+json_test_int(void **state)
+{
+    char buffer[64];
+    rdsparser_json_writer_t writer = { buffer, sizeof(buffer), 0, false, true };
+
+    rdsparser_json_int(&writer, 0);
+    rdsparser_json_put(&writer, ' ');
+    rdsparser_json_int(&writer, -1234);
+    rdsparser_json_put(&writer, ' ');
+    rdsparser_json_int(&writer, INT64_MIN);
+    buffer[writer.length] = '\0';
+
+    assert_string_equal(buffer, "0 -1234 -9223372036854775808");
+    assert_false(writer.overflow);
+}
+
+static void
+json_test_key(void **state)
+{
+    char buffer[64];
+    rdsparser_json_writer_t writer = { buffer, sizeof(buffer), 0, false, true };
+
+    rdsparser_json_number(&writer, "a", 1, true);
+    rdsparser_json_number(&writer, "b", 2, false);
+    buffer[writer.length] = '\0';
+
+    assert_string_equal(buffer, "\"a\":1,\"b\":null");
+}
+
+static void
+json_test_overflow(void **state)
+{
+    char buffer[4];
+    rdsparser_json_writer_t writer = { buffer, sizeof(buffer), 0, false, true };
+
+    rdsparser_json_raw(&writer, "abc");
+    assert_false(writer.overflow);
+    assert_int_equal(writer.length, 3);
+
+    /* The last byte is reserved for the terminating null */
+    rdsparser_json_put(&writer, 'd');
+    assert_true(writer.overflow);
+    assert_int_equal(writer.length, 3);
+}
+
+static void
+json_test_dirty(void **state)
+{
+    rdsparser_json_t json;
+
+    rdsparser_json_clear(&json);
+    assert_int_equal(json.dirty, RDSPARSER_JSON_DIRTY_ALL);
+    assert_false(json.ct);
+
+    json.dirty = 0;
+    rdsparser_json_mark(&json, RDSPARSER_JSON_DIRTY(RDSPARSER_FIELD_PS));
+    rdsparser_json_mark(&json, RDSPARSER_JSON_DIRTY_AF);
+    assert_int_equal(json.dirty, (1u << RDSPARSER_FIELD_PS) | RDSPARSER_JSON_DIRTY_AF);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(json_test_int, NULL, NULL),
+    cmocka_unit_test_setup_teardown(json_test_key, NULL, NULL),
+    cmocka_unit_test_setup_teardown(json_test_overflow, NULL, NULL),
+    cmocka_unit_test_setup_teardown(json_test_dirty, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
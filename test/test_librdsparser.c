@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <unistd.h>
 #include <librdsparser.h>
 #include "parser.h"
 
@@ -57,7 +58,7 @@ static int
 test_teardown(void **state)
 {
     test_context_t *ctx = *state;
-    (void)ctx;
+    rdsparser_deinit(&ctx->rds);
     return 0;
 }
 
@@ -101,6 +102,7 @@ callback_ms(rdsparser_t *rds,
     function_called();
 }
 
+#ifndef RDSPARSER_DISABLE_GROUP1
 static void
 callback_ecc(rdsparser_t *rds,
              void        *user_data)
@@ -117,6 +119,34 @@ callback_country(rdsparser_t *rds,
     function_called();
 }
 
+static void
+callback_pin(rdsparser_t *rds,
+             void        *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_la(rdsparser_t *rds,
+            void        *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_slc(rdsparser_t             *rds,
+             rdsparser_slc_variant_t  variant,
+             void                    *user_data)
+{
+    (void)user_data;
+    check_expected(variant);
+    function_called();
+}
+#endif
+
+#ifndef RDSPARSER_DISABLE_AF
 static void
 callback_af(rdsparser_t *rds,
             uint32_t     new_af,
@@ -126,6 +156,17 @@ callback_af(rdsparser_t *rds,
     function_called();
 }
 
+static void
+callback_af_expire(rdsparser_t *rds,
+                   uint32_t     old_af,
+                   void        *user_data)
+{
+    (void)user_data;
+    check_expected(old_af);
+    function_called();
+}
+#endif
+
 static void
 callback_ps(rdsparser_t *rds,
             void        *user_data)
@@ -143,6 +184,7 @@ callback_rt(rdsparser_t         *rds,
     function_called();
 }
 
+#ifndef RDSPARSER_DISABLE_GROUP10
 static void
 callback_ptyn(rdsparser_t *rds,
               void        *user_data)
@@ -150,7 +192,9 @@ callback_ptyn(rdsparser_t *rds,
     (void)user_data;
     function_called();
 }
+#endif
 
+#ifndef RDSPARSER_DISABLE_GROUP4
 static void
 callback_ct(rdsparser_t          *rds,
             const rdsparser_ct_t *ct,
@@ -159,6 +203,89 @@ callback_ct(rdsparser_t          *rds,
     (void)user_data;
     function_called();
 }
+#endif
+
+static void
+callback_eon(rdsparser_t           *rds,
+             const rdsparser_eon_t *eon,
+             void                  *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_rt_complete(rdsparser_t         *rds,
+                     rdsparser_rt_flag_t  flag,
+                     void                *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_rtplus(rdsparser_t                  *rds,
+                const rdsparser_rtplus_tag_t *tag,
+                void                         *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_oda_announce(rdsparser_t *rds,
+                      uint8_t      group,
+                      bool         flag,
+                      uint16_t     aid,
+                      void        *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_oda(rdsparser_t             *rds,
+             uint16_t                 aid,
+             const rdsparser_data_t   data,
+             const rdsparser_error_t  errors,
+             void                    *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_tmc(rdsparser_t *rds,
+             void        *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_lps(rdsparser_t *rds,
+             void        *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_ert(rdsparser_t *rds,
+             void        *user_data)
+{
+    (void)user_data;
+    function_called();
+}
+
+static void
+callback_eon_ta(rdsparser_t           *rds,
+                const rdsparser_eon_t *eon,
+                void                  *user_data)
+{
+    (void)user_data;
+    function_called();
+}
 
 /* ------------------------------------------------ */
 
@@ -174,13 +301,30 @@ rdsparser_test_reset(void **state)
     assert_int_equal(rdsparser_get_ms(&ctx->rds), RDSPARSER_MS_UNKNOWN);
     assert_int_equal(rdsparser_get_ecc(&ctx->rds), RDSPARSER_ECC_UNKNOWN);
     assert_int_equal(rdsparser_get_country(&ctx->rds), RDSPARSER_COUNTRY_UNKNOWN);
+    assert_int_equal(rdsparser_get_pin(&ctx->rds), RDSPARSER_PIN_UNKNOWN);
+    assert_int_equal(rdsparser_get_la(&ctx->rds), RDSPARSER_LA_UNKNOWN);
+    for (uint8_t i = 0; i < RDSPARSER_SLC_VARIANT_COUNT; i++)
+    {
+        assert_int_equal(rdsparser_get_slc(&ctx->rds, i), RDSPARSER_SLC_UNKNOWN);
+    }
 
     const rdsparser_af_t *af = rdsparser_get_af(&ctx->rds);
-    for (uint8_t i = 0; i < RDSPARSER_AF_BUFFER_SIZE; i++)
+    for (uint8_t i = 0; i < RDSPARSER_AF_BITMAP_WORDS; i++)
     {
         assert_int_equal(af->buffer[i], 0);
     }
 
+    assert_int_equal(rdsparser_get_eon_count(&ctx->rds), 0);
+    assert_true(rdsparser_get_eon(&ctx->rds, 0) == NULL);
+    assert_int_equal(rdsparser_get_rtplus_count(&ctx->rds), 0);
+    assert_int_equal(rdsparser_get_rtplus_running(&ctx->rds), false);
+    assert_true(rdsparser_get_rtplus(&ctx->rds, 0) == NULL);
+    assert_int_equal(rdsparser_get_oda(&ctx->rds, 11, false), 0);
+    assert_int_equal(rdsparser_get_tmc_pending(&ctx->rds), 0);
+    assert_int_equal(rdsparser_get_tmc_overflow(&ctx->rds), 0);
+    assert_true(rdsparser_get_lps(&ctx->rds) == NULL);
+    assert_true(rdsparser_get_ert(&ctx->rds) == NULL);
+
     const rdsparser_string_t *string;
     const rdsparser_string_char_t *content;
     const rdsparser_string_error_t *errors;
@@ -304,6 +448,133 @@ rdsparser_test_parse_string_long(void **state)
     assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234567890123458123456789012345678901234567890"), false);
 }
 
+static void
+rdsparser_test_parse_buffer(void **state)
+{
+    test_context_t *ctx = *state;
+    const char buffer[] = "3566100000E20000\n"
+                          "invalid\n"
+                          "\n"
+                          "34DB054AE3054F2015\r\n"
+                          "X234567890123456\n"
+                          "A201200674697363";
+
+    assert_int_equal(rdsparser_parse_buffer(&ctx->rds, buffer, 0), 0);
+    assert_int_equal(rdsparser_parse_buffer(&ctx->rds, buffer, sizeof(buffer) - 1), 3);
+    assert_int_equal(rdsparser_get_pi(&ctx->rds), 0xA201);
+
+    /* Truncated last line */
+    assert_int_equal(rdsparser_parse_buffer(&ctx->rds, buffer, 16), 1);
+    assert_int_equal(rdsparser_parse_buffer(&ctx->rds, buffer, 15), 0);
+}
+
+static void
+rdsparser_test_read_group(void **state)
+{
+    const char buffer[] = "3566100000E20000\n"
+                          "invalid\n"
+                          "34DB054AE3054F2015\r\n"
+                          "X234567890123456";
+    const char *input = buffer;
+    const char *end = buffer + sizeof(buffer) - 1;
+    rdsparser_data_t data;
+    rdsparser_error_t errors;
+
+    assert_true(rdsparser_read_group(&input, end, data, errors));
+    assert_int_equal(data[RDSPARSER_BLOCK_A], 0x3566);
+    assert_int_equal(data[RDSPARSER_BLOCK_D], 0x0000);
+    assert_int_equal(errors[RDSPARSER_BLOCK_A], 0);
+    assert_true(input == buffer + 17);
+
+    /* Invalid line skipped */
+    assert_true(rdsparser_read_group(&input, end, data, errors));
+    assert_int_equal(data[RDSPARSER_BLOCK_A], 0x34DB);
+    assert_int_equal(data[RDSPARSER_BLOCK_D], 0x4F20);
+    assert_int_equal(errors[RDSPARSER_BLOCK_B], 1);
+    assert_int_equal(errors[RDSPARSER_BLOCK_D], 1);
+
+    assert_false(rdsparser_read_group(&input, end, data, errors));
+    assert_true(input == end);
+    assert_false(rdsparser_read_group(&input, end, data, errors));
+}
+
+#ifndef RDSPARSER_DISABLE_FILE
+static void
+rdsparser_test_parse_file(void **state)
+{
+    test_context_t *ctx = *state;
+    char path[] = "/tmp/rdsparser_test_XXXXXX";
+    const int fd = mkstemp(path);
+    assert_true(fd >= 0);
+
+    FILE *file = fdopen(fd, "w");
+    assert_non_null(file);
+    fputs("3566100000E20000\n34DB054AE3054F2015\n", file);
+    fclose(file);
+
+    assert_int_equal(rdsparser_parse_file(&ctx->rds, path), 2);
+    assert_int_equal(rdsparser_get_pi(&ctx->rds), 0x34DB);
+    unlink(path);
+
+    assert_int_equal(rdsparser_parse_file(&ctx->rds, path), -1);
+}
+
+static void
+rdsparser_test_file_map(void **state)
+{
+    char path[] = "/tmp/rdsparser_test_XXXXXX";
+    const int fd = mkstemp(path);
+    assert_true(fd >= 0);
+    close(fd);
+
+    const char *data;
+    size_t length;
+
+    /* Empty file, nothing mapped */
+    assert_true(rdsparser_file_map(path, &data, &length));
+    assert_null(data);
+    assert_int_equal(length, 0);
+    rdsparser_file_unmap(data, length);
+
+    FILE *file = fopen(path, "w");
+    assert_non_null(file);
+    fputs("3566100000E20000\n", file);
+    fclose(file);
+
+    assert_true(rdsparser_file_map(path, &data, &length));
+    assert_int_equal(length, 17);
+    assert_memory_equal(data, "3566100000E20000\n", 17);
+    rdsparser_file_unmap(data, length);
+    unlink(path);
+
+    assert_false(rdsparser_file_map(path, &data, &length));
+}
+
+static void
+rdsparser_test_parse_file_log(void **state)
+{
+    test_context_t *ctx = *state;
+    char path[] = "/tmp/rdsparser_test_XXXXXX";
+    const int fd = mkstemp(path);
+    assert_true(fd >= 0);
+
+    FILE *file = fdopen(fd, "wb");
+    assert_non_null(file);
+
+    rdsparser_log_writer_t writer;
+    const rdsparser_data_t data[2] = { { 0x3566, 0x1000, 0x00E2, 0x0000 }, { 0x34DB, 0x054A, 0xE305, 0x4F20 } };
+    const rdsparser_error_t errors = { 0, 0, 0, 0 };
+    assert_true(rdsparser_log_writer_init(&writer, file, RDSPARSER_LOG_SYNC_INTERVAL));
+    assert_true(rdsparser_log_write(&writer, 1000, data[0], errors));
+    assert_true(rdsparser_log_write(&writer, 1088, data[1], errors));
+    fclose(file);
+
+    assert_int_equal(rdsparser_parse_file(&ctx->rds, path), 2);
+    assert_int_equal(rdsparser_get_pi(&ctx->rds), 0x34DB);
+    unlink(path);
+}
+#endif
+
 static void
 test_correction(void                  **state,
                 rdsparser_text_t        text,
@@ -447,6 +718,7 @@ rdsparser_test_register_pty(void **state)
     assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234567890123458"), true);
 }
 
+#ifndef RDSPARSER_DISABLE_GROUP1
 static void
 rdsparser_test_register_ecc(void **state)
 {
@@ -465,6 +737,76 @@ rdsparser_test_register_country(void **state)
     assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB154000E2000000"), true);
 }
 
+static void
+rdsparser_test_register_pin(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_pin(&ctx->rds, callback_pin);
+
+    /* No valid PIN (day 0) */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3566100000E20000"), true);
+    assert_int_equal(rdsparser_get_pin(&ctx->rds), RDSPARSER_PIN_UNKNOWN);
+
+    expect_function_call(callback_pin);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3566100000E2A5C5"), true);
+    assert_int_equal(rdsparser_get_pin(&ctx->rds), 0xA5C5);
+    assert_int_equal(rdsparser_pin_get_day(rdsparser_get_pin(&ctx->rds)), 20);
+    assert_int_equal(rdsparser_pin_get_hour(rdsparser_get_pin(&ctx->rds)), 23);
+    assert_int_equal(rdsparser_pin_get_minute(rdsparser_get_pin(&ctx->rds)), 5);
+
+    /* Group 1B */
+    expect_function_call(callback_pin);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3566180035660A40"), true);
+    assert_int_equal(rdsparser_get_pin(&ctx->rds), 0x0A40);
+}
+
+static void
+rdsparser_test_register_la(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_la(&ctx->rds, callback_la);
+
+    expect_function_call(callback_la);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3566100080E20000"), true);
+    assert_int_equal(rdsparser_get_la(&ctx->rds), RDSPARSER_LA_ON);
+
+    expect_function_call(callback_la);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3566100000E20000"), true);
+    assert_int_equal(rdsparser_get_la(&ctx->rds), RDSPARSER_LA_OFF);
+}
+
+static void
+rdsparser_test_register_slc(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_slc(&ctx->rds, callback_slc);
+
+    expect_value(callback_slc, variant, RDSPARSER_SLC_PAGING_ECC);
+    expect_function_call(callback_slc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3566100000E20000"), true);
+    assert_int_equal(rdsparser_get_slc(&ctx->rds, RDSPARSER_SLC_PAGING_ECC), 0x0E2);
+
+    expect_value(callback_slc, variant, RDSPARSER_SLC_TMC_ID);
+    expect_function_call(callback_slc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3566100010230000"), true);
+    assert_int_equal(rdsparser_get_slc(&ctx->rds, RDSPARSER_SLC_TMC_ID), 0x023);
+
+    expect_value(callback_slc, variant, RDSPARSER_SLC_LANGUAGE);
+    expect_function_call(callback_slc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "356610003008000000"), true);
+    assert_int_equal(rdsparser_get_slc(&ctx->rds, RDSPARSER_SLC_LANGUAGE), 0x008);
+
+    /* Block C with errors */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "356610003009000004"), true);
+    assert_int_equal(rdsparser_get_slc(&ctx->rds, RDSPARSER_SLC_LANGUAGE), 0x008);
+
+    /* Same value, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3566100030080000"), true);
+    assert_int_equal(rdsparser_get_slc(&ctx->rds, RDSPARSER_SLC_VARIANT_COUNT), RDSPARSER_SLC_UNKNOWN);
+}
+#endif
+
+#ifndef RDSPARSER_DISABLE_AF
 static void
 rdsparser_test_register_af(void **state)
 {
@@ -474,6 +816,430 @@ rdsparser_test_register_af(void **state)
     assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234007890123458"), true);
 }
 
+static void
+rdsparser_test_af_ageing(void **state)
+{
+    test_context_t *ctx = *state;
+
+    assert_int_equal(rdsparser_get_af_ageing(&ctx->rds), false);
+    rdsparser_set_af_ageing(&ctx->rds, true);
+    assert_int_equal(rdsparser_get_af_ageing(&ctx->rds), true);
+    rdsparser_set_af_ageing(&ctx->rds, false);
+    assert_int_equal(rdsparser_get_af_ageing(&ctx->rds), false);
+}
+#endif
+
+#ifndef RDSPARSER_DISABLE_GROUP4
+static void
+rdsparser_test_ct_filter(void **state)
+{
+    test_context_t *ctx = *state;
+
+    assert_int_equal(rdsparser_get_ct_filter(&ctx->rds), false);
+    rdsparser_set_ct_filter(&ctx->rds, true);
+    assert_int_equal(rdsparser_get_ct_filter(&ctx->rds), true);
+    rdsparser_set_ct_filter(&ctx->rds, false);
+    assert_int_equal(rdsparser_get_ct_filter(&ctx->rds), false);
+}
+#endif
+
+static void
+rdsparser_test_ttl(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_ta(&ctx->rds, callback_ta);
+    rdsparser_register_ps(&ctx->rds, callback_ps);
+
+    assert_int_equal(rdsparser_get_ttl(&ctx->rds, RDSPARSER_FIELD_TA), 0);
+    rdsparser_set_ttl(&ctx->rds, RDSPARSER_FIELD_TA, 1000);
+    rdsparser_set_ttl(&ctx->rds, RDSPARSER_FIELD_PS, 5000);
+    assert_int_equal(rdsparser_get_ttl(&ctx->rds, RDSPARSER_FIELD_TA), 1000);
+    assert_int_equal(rdsparser_get_ttl(&ctx->rds, RDSPARSER_FIELD_COUNT), 0);
+
+    rdsparser_data_t group0 = { 0x1234, 0x0010, 0x0000, 0x4142 };
+    rdsparser_data_t group2 = { 0x1234, 0x2000, 0x4142, 0x4344 };
+    rdsparser_error_t errors = { 0, 0, 0, 0 };
+
+    /* TA on, PS "AB" */
+    expect_function_call(callback_ta);
+    expect_function_call(callback_ps);
+    rdsparser_parse_ts(&ctx->rds, group0, errors, 100);
+    assert_int_equal(rdsparser_get_last_seen(&ctx->rds, RDSPARSER_FIELD_TA), 100);
+
+    /* Refreshed before the deadline */
+    rdsparser_parse_ts(&ctx->rds, group0, errors, 900);
+    rdsparser_expire(&ctx->rds, 1100);
+    assert_int_equal(rdsparser_get_ta(&ctx->rds), RDSPARSER_TA_ON);
+
+    /* Other groups do not refresh the TA */
+    rdsparser_parse_ts(&ctx->rds, group2, errors, 1500);
+    assert_int_equal(rdsparser_get_last_seen(&ctx->rds, RDSPARSER_FIELD_PI), 1500);
+    assert_int_equal(rdsparser_get_ta(&ctx->rds), RDSPARSER_TA_ON);
+
+    expect_function_call(callback_ta);
+    rdsparser_parse_ts(&ctx->rds, group2, errors, 1900);
+    assert_int_equal(rdsparser_get_ta(&ctx->rds), RDSPARSER_TA_UNKNOWN);
+    assert_true(rdsparser_string_get_available(rdsparser_get_ps(&ctx->rds)));
+
+    /* No signal at all */
+    rdsparser_expire(&ctx->rds, 5899);
+    expect_function_call(callback_ps);
+    rdsparser_expire(&ctx->rds, 5900);
+    assert_false(rdsparser_string_get_available(rdsparser_get_ps(&ctx->rds)));
+    rdsparser_expire(&ctx->rds, 10000);
+
+    /* Fields without TTL stay valid */
+    assert_int_equal(rdsparser_get_pi(&ctx->rds), 0x1234);
+}
+
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+static void
+test_station_ps(rdsparser_t *rds,
+                const char  *ps)
+{
+    for (uint16_t i = 0; i < RDSPARSER_PS_LENGTH / 2; i++)
+    {
+        rdsparser_data_t data = { 0x1234, i, 0x0000, (uint16_t)((ps[2 * i] << 8) | ps[2 * i + 1]) };
+        rdsparser_error_t errors = { 0, 0, 0, 0 };
+        rdsparser_parse(rds, data, errors);
+    }
+}
+
+static void
+rdsparser_test_station_cache(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_data_t data = { 0x1234, 0x2000, 0x4142, 0x4344 };
+    rdsparser_error_t errors = { 0, 0, 0, 0 };
+
+    assert_int_equal(rdsparser_get_station_cache(&ctx->rds), RDSPARSER_STATION_CACHE_OFF);
+    test_station_ps(&ctx->rds, "STATION1");
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_get_station_cache_count(&ctx->rds), 0);
+
+    assert_true(rdsparser_set_station_cache(&ctx->rds, RDSPARSER_STATION_CACHE_PI));
+    assert_int_equal(rdsparser_get_station_cache(&ctx->rds), RDSPARSER_STATION_CACHE_PI);
+    test_station_ps(&ctx->rds, "STATION1");
+    assert_true(rdsparser_parse_string(&ctx->rds, "1234000078900000"));
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_get_station_cache_count(&ctx->rds), 1);
+    assert_false(rdsparser_string_get_available(rdsparser_get_ps(&ctx->rds)));
+
+    /* PS and AF are back as soon as the PI is received */
+    rdsparser_register_pi(&ctx->rds, callback_pi);
+    rdsparser_register_ps(&ctx->rds, callback_ps);
+    expect_function_call(callback_pi);
+    expect_function_call(callback_ps);
+    rdsparser_parse(&ctx->rds, data, errors);
+#ifndef RDSPARSER_DISABLE_AF
+    assert_int_equal(rdsparser_af_count(rdsparser_get_af(&ctx->rds)), 2);
+#endif
+
+    char ps[RDSPARSER_PS_LENGTH * 3 + 1];
+    rdsparser_string_get_utf8(rdsparser_get_ps(&ctx->rds), ps, sizeof(ps));
+    assert_string_equal(ps, "STATION1");
+    const rdsparser_string_error_t *ps_errors = rdsparser_string_get_errors(rdsparser_get_ps(&ctx->rds));
+    assert_int_equal(ps_errors[0], RDSPARSER_STRING_ERROR_NONE);
+
+    /* Other frequency in the PI + frequency mode */
+    assert_true(rdsparser_set_station_cache(&ctx->rds, RDSPARSER_STATION_CACHE_PI_FREQUENCY));
+    assert_int_equal(rdsparser_get_station_cache_count(&ctx->rds), 0);
+    rdsparser_set_frequency(&ctx->rds, 101900);
+    assert_int_equal(rdsparser_get_frequency(&ctx->rds), 101900);
+    rdsparser_clear(&ctx->rds);
+    rdsparser_set_frequency(&ctx->rds, 95000);
+
+    expect_function_call(callback_pi);
+    rdsparser_parse(&ctx->rds, data, errors);
+    assert_false(rdsparser_string_get_available(rdsparser_get_ps(&ctx->rds)));
+
+    rdsparser_clear_station_cache(&ctx->rds);
+    assert_int_equal(rdsparser_get_station_cache_count(&ctx->rds), 0);
+
+    /* Disabled cache forgets its entries */
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_get_station_cache_count(&ctx->rds), 1);
+    assert_true(rdsparser_set_station_cache(&ctx->rds, RDSPARSER_STATION_CACHE_OFF));
+    assert_int_equal(rdsparser_get_station_cache_count(&ctx->rds), 0);
+    rdsparser_clear_station_cache(&ctx->rds);
+}
+
+static void
+rdsparser_test_station_cache_miss(void **state)
+{
+    test_context_t *ctx = *state;
+    char ps[RDSPARSER_PS_LENGTH * 3 + 1];
+
+    assert_true(rdsparser_set_station_cache(&ctx->rds, RDSPARSER_STATION_CACHE_PI));
+    assert_true(rdsparser_parse_string(&ctx->rds, "1111000000004141"));
+    assert_true(rdsparser_parse_string(&ctx->rds, "1111000100004141"));
+    assert_true(rdsparser_parse_string(&ctx->rds, "1111000200004141"));
+    assert_true(rdsparser_parse_string(&ctx->rds, "1111000300004141"));
+
+    /* The PS of the previous station is not carried over to an unknown one */
+    rdsparser_register_ps(&ctx->rds, callback_ps);
+    expect_function_call(callback_ps);
+    assert_true(rdsparser_parse_string(&ctx->rds, "2222100000000000"));
+    assert_false(rdsparser_string_get_available(rdsparser_get_ps(&ctx->rds)));
+
+    /* Nor saved as its state */
+    rdsparser_clear(&ctx->rds);
+    assert_true(rdsparser_parse_string(&ctx->rds, "2222100000000000"));
+    assert_false(rdsparser_string_get_available(rdsparser_get_ps(&ctx->rds)));
+
+    expect_function_call(callback_ps);
+    assert_true(rdsparser_parse_string(&ctx->rds, "1111100000000000"));
+    rdsparser_string_get_utf8(rdsparser_get_ps(&ctx->rds), ps, sizeof(ps));
+    assert_string_equal(ps, "AAAAAAAA");
+}
+#endif
+
+static void
+rdsparser_test_events(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_event_t event;
+
+    assert_false(rdsparser_get_events(&ctx->rds));
+    assert_false(rdsparser_pop_event(&ctx->rds, &event));
+    assert_true(rdsparser_set_events(&ctx->rds, true));
+    assert_true(rdsparser_get_events(&ctx->rds));
+
+    /* PI, PTY, TP, TA, MS, PS */
+    assert_true(rdsparser_parse_string(&ctx->rds, "12340409E0CD4142"));
+    const rdsparser_event_type_t expected[] =
+    {
+        RDSPARSER_EVENT_PI,
+        RDSPARSER_EVENT_PTY,
+        RDSPARSER_EVENT_TP,
+        RDSPARSER_EVENT_TA,
+        RDSPARSER_EVENT_MS,
+        RDSPARSER_EVENT_PS
+    };
+
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++)
+    {
+        assert_true(rdsparser_pop_event(&ctx->rds, &event));
+        assert_int_equal(event.type, expected[i]);
+
+        switch (event.type)
+        {
+            case RDSPARSER_EVENT_PI:
+                assert_int_equal(event.value, 0x1234);
+                break;
+
+            case RDSPARSER_EVENT_PTY:
+                assert_int_equal(event.value, 0);
+                break;
+
+            case RDSPARSER_EVENT_MS:
+                assert_int_equal(event.value, RDSPARSER_MS_MUSIC);
+                break;
+
+            case RDSPARSER_EVENT_PS:
+                assert_int_equal(event.start, 2);
+                assert_int_equal(event.length, 2);
+                assert_int_equal(event.text[0], 'A');
+                assert_int_equal(event.text[1], 'B');
+                break;
+        }
+    }
+
+    assert_false(rdsparser_pop_event(&ctx->rds, &event));
+
+    /* The parser never blocks on a full queue */
+    for (uint16_t i = 0; i < RDSPARSER_EVENT_QUEUE_SIZE + 10; i++)
+    {
+        char group[17];
+        snprintf(group, sizeof(group), "%04X000000000000", i + 1);
+        assert_true(rdsparser_parse_string(&ctx->rds, group));
+    }
+
+    /* PI of every group, TP and MS of the first one */
+    assert_int_equal(rdsparser_get_event_overflow(&ctx->rds), 12);
+
+    /* Batches are limited by the capacity and follow the ring order */
+    rdsparser_event_t batch[100];
+    int64_t pi = 0;
+    size_t total = 0;
+    size_t count;
+    while ((count = rdsparser_poll_events(&ctx->rds, batch, 100)))
+    {
+        assert_true(count <= 100);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (batch[i].type == RDSPARSER_EVENT_PI)
+            {
+                assert_int_equal(batch[i].value, ++pi);
+            }
+        }
+        total += count;
+    }
+    assert_int_equal(total, RDSPARSER_EVENT_QUEUE_SIZE);
+    assert_int_equal(rdsparser_poll_events(&ctx->rds, batch, 100), 0);
+
+    assert_true(rdsparser_set_events(&ctx->rds, false));
+    assert_false(rdsparser_pop_event(&ctx->rds, &event));
+}
+
+static void
+rdsparser_test_events_text(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_error_t errors = {0, 0, 0, 0};
+    rdsparser_data_t group2 = {0x1234, 0x2000, 0x4142, 0x4344};
+    rdsparser_event_t event;
+    uint8_t start = 0;
+
+    assert_true(rdsparser_set_events(&ctx->rds, true));
+    rdsparser_set_ttl(&ctx->rds, RDSPARSER_FIELD_RT, 1000);
+
+    /* The changed characters are carried by the event */
+    rdsparser_parse_ts(&ctx->rds, group2, errors, 0);
+    while (rdsparser_pop_event(&ctx->rds, &event))
+    {
+        if (event.type == RDSPARSER_EVENT_RT)
+        {
+            assert_int_equal(event.index, RDSPARSER_RT_FLAG_A);
+            assert_int_equal(event.start, 0);
+            assert_int_equal(event.length, 4);
+            assert_int_equal(event.text[0], 'A');
+            assert_int_equal(event.text[1], 'B');
+            assert_int_equal(event.text[2], 'C');
+            assert_int_equal(event.text[3], 'D');
+            start += event.length;
+        }
+    }
+    assert_int_equal(start, 4);
+
+    /* The whole cleared RadioText is split into consecutive events */
+    rdsparser_expire(&ctx->rds, 2000);
+    start = 0;
+    while (rdsparser_pop_event(&ctx->rds, &event))
+    {
+        if (event.type == RDSPARSER_EVENT_RT)
+        {
+            assert_int_equal(event.start, start);
+            assert_int_equal(event.length, RDSPARSER_EVENT_TEXT_LENGTH);
+            for (uint8_t i = 0; i < event.length; i++)
+            {
+                assert_int_equal(event.text[i], ' ');
+            }
+            start += event.length;
+        }
+    }
+    assert_int_equal(start, RDSPARSER_RT_LENGTH);
+
+    assert_true(rdsparser_set_events(&ctx->rds, false));
+}
+
+#if !defined(RDSPARSER_DISABLE_RT_B) && !defined(RDSPARSER_DISABLE_GROUP4)
+static void
+rdsparser_test_json(void **state)
+{
+    test_context_t *ctx = *state;
+    char buffer[512];
+
+    assert_int_equal(rdsparser_write_json(&ctx->rds, buffer, sizeof(buffer), 0), 135);
+    assert_string_equal(buffer, "{\"pi\":null,\"pty\":null,\"tp\":null,\"ta\":null,\"ms\":null,\"ecc\":null,\"country\":null,"
+                                "\"af\":[],\"ps\":null,\"rt\":[null,null],\"ptyn\":null,\"ct\":null}");
+
+    /* Nothing changed since the last call */
+    assert_int_equal(rdsparser_write_json_delta(&ctx->rds, buffer, sizeof(buffer), 0), 2);
+    assert_string_equal(buffer, "{}");
+
+    assert_true(rdsparser_parse_string(&ctx->rds, "12340409E0CD4142"));
+
+    /* Too small buffer keeps the changes for the next call */
+    assert_int_equal(rdsparser_write_json_delta(&ctx->rds, buffer, 16, 0), 0);
+    assert_string_equal(buffer, "");
+
+    rdsparser_write_json_delta(&ctx->rds, buffer, sizeof(buffer), RDSPARSER_JSON_ERRORS);
+    assert_string_equal(buffer, "{\"pi\":4660,\"pty\":0,\"tp\":1,\"ta\":0,\"ms\":1,"
+                                "\"ps\":\"  AB    \",\"ps_errors\":[10,10,0,0,10,10,10,10]}");
+
+    /* Quotes and backslashes in the RadioText are escaped */
+    assert_true(rdsparser_parse_string(&ctx->rds, "12342000225C2241"));
+    assert_true(rdsparser_parse_string(&ctx->rds, "12344001D750018200"));
+    rdsparser_write_json_delta(&ctx->rds, buffer, sizeof(buffer), 0);
+    assert_string_equal(buffer, "{\"tp\":0,\"rt\":[\"\\\"\\\\\\\"A                                                            \",null],"
+                                "\"ct\":{\"epoch\":1705622760,\"offset\":60}}");
+
+    /* Expiry of a field that was never received is not a change */
+    rdsparser_set_ttl(&ctx->rds, RDSPARSER_FIELD_ECC, 1000);
+    rdsparser_set_ttl(&ctx->rds, RDSPARSER_FIELD_PTYN, 1000);
+    rdsparser_expire(&ctx->rds, 5000);
+    assert_int_equal(rdsparser_write_json_delta(&ctx->rds, buffer, sizeof(buffer), 0), 2);
+    assert_string_equal(buffer, "{}");
+
+    /* A reset is reported as a full update */
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_write_json_delta(&ctx->rds, buffer, sizeof(buffer), 0), 135);
+}
+#endif
+
+#ifndef RDSPARSER_DISABLE_AF
+static void
+rdsparser_test_register_af_expire(void **state)
+{
+    test_context_t *ctx = *state;
+    const rdsparser_af_t *af = rdsparser_get_af(&ctx->rds);
+    rdsparser_register_af_expire(&ctx->rds, callback_af_expire);
+    rdsparser_set_af_ageing(&ctx->rds, true);
+
+    /* 0x78 and 0x90 */
+    rdsparser_set_time(&ctx->rds, 1000);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234007878900000"), true);
+    rdsparser_set_time(&ctx->rds, 5000);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234007890200000"), true);
+    assert_int_equal(rdsparser_af_count(af), 3);
+    assert_int_equal(rdsparser_get_af_hits(&ctx->rds, 101900), 2);
+    assert_int_equal(rdsparser_get_af_last_seen(&ctx->rds, 101900), 5000);
+    assert_int_equal(rdsparser_get_af_hits(&ctx->rds, 99500), 1);
+
+    rdsparser_af_expire(&ctx->rds, 5500, 4500);
+    assert_int_equal(rdsparser_af_count(af), 3);
+
+    expect_value(callback_af_expire, old_af, 99500);
+    expect_function_call(callback_af_expire);
+    rdsparser_af_expire(&ctx->rds, 5501, 4500);
+    assert_int_equal(rdsparser_af_count(af), 2);
+    assert_int_equal(rdsparser_get_af_hits(&ctx->rds, 99500), 0);
+
+    expect_value(callback_af_expire, old_af, 90700);
+    expect_function_call(callback_af_expire);
+    expect_value(callback_af_expire, old_af, 101900);
+    expect_function_call(callback_af_expire);
+    rdsparser_af_expire(&ctx->rds, 20000, 4500);
+    assert_int_equal(rdsparser_af_count(af), 0);
+}
+
+static void
+rdsparser_test_af_ageing_ticks(void **state)
+{
+    test_context_t *ctx = *state;
+    const uint64_t start = (uint64_t)60 * 24 * 3600 * 1000;
+    rdsparser_register_af_expire(&ctx->rds, callback_af_expire);
+    rdsparser_set_af_ageing(&ctx->rds, true);
+    assert_int_equal(rdsparser_get_af_last_seen(&ctx->rds, 101900), 0);
+
+    /* Milliseconds after 60 days */
+    rdsparser_set_time(&ctx->rds, start);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234007878900000"), true);
+    assert_true(rdsparser_get_af_last_seen(&ctx->rds, 101900) == start);
+
+    rdsparser_af_expire(&ctx->rds, start + 4500, 4500);
+    expect_value(callback_af_expire, old_af, 99500);
+    expect_function_call(callback_af_expire);
+    expect_value(callback_af_expire, old_af, 101900);
+    expect_function_call(callback_af_expire);
+    rdsparser_af_expire(&ctx->rds, start + (uint64_t)UINT32_MAX + 4501, 4500);
+
+    rdsparser_set_af_ageing(&ctx->rds, false);
+    assert_int_equal(rdsparser_get_af_hits(&ctx->rds, 101900), 0);
+}
+#endif
+
 static void
 rdsparser_test_register_ps(void **state)
 {
@@ -494,6 +1260,16 @@ rdsparser_test_register_rt(void **state)
     assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB254F3420303000"), true);
 }
 
+static void
+rdsparser_test_register_rt_complete(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_rt_complete(&ctx->rds, callback_rt_complete);
+    expect_function_call(callback_rt_complete);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB25400D20202000"), true);
+}
+
+#ifndef RDSPARSER_DISABLE_GROUP10
 static void
 rdsparser_test_register_ptyn(void **state)
 {
@@ -503,6 +1279,21 @@ rdsparser_test_register_ptyn(void **state)
     assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DBA5505241444900"), true);
 }
 
+static void
+rdsparser_test_ptyn_oda_announce(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_ptyn(&ctx->rds, callback_ptyn);
+
+    /* RT+ announced on 10A must not take over PTYN */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "1111301400004BD700"), true);
+    expect_function_call(callback_ptyn);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DBA5505241444900"), true);
+    assert_int_equal(rdsparser_string_get_content(rdsparser_get_ptyn(&ctx->rds))[0], 'R');
+}
+#endif
+
+#ifndef RDSPARSER_DISABLE_GROUP4
 static void
 rdsparser_test_register_ct(void **state)
 {
@@ -511,6 +1302,228 @@ rdsparser_test_register_ct(void **state)
     expect_function_call(callback_ct);
     assert_int_equal(rdsparser_parse_string(&ctx->rds, "3F444541D7500580"), true);
 }
+#endif
+
+static void
+rdsparser_test_register_eon(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_eon(&ctx->rds, callback_eon);
+    expect_function_call(callback_eon);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E0005241320100"), true);
+}
+
+static void
+rdsparser_test_register_eon_ta(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_eon_ta(&ctx->rds, callback_eon_ta);
+    expect_function_call(callback_eon_ta);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E8183211320100"), true);
+}
+
+static void
+rdsparser_test_register_rtplus(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_rtplus(&ctx->rds, callback_rtplus);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321120004142434400"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211301600004BD700"), true);
+    expect_function_call(callback_rtplus);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211B0088006000000"), true);
+}
+
+static void
+rdsparser_test_register_oda_announce(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_oda_announce(&ctx->rds, callback_oda_announce);
+    expect_function_call(callback_oda_announce);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211301600004BD700"), true);
+}
+
+static void
+rdsparser_test_register_oda(void **state)
+{
+    test_context_t *ctx = *state;
+    assert_int_equal(rdsparser_register_oda(&ctx->rds, 0x4BD7, callback_oda), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211301600004BD700"), true);
+    expect_function_call(callback_oda);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211B0088006000000"), true);
+}
+
+static void
+rdsparser_test_register_tmc(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_tmc(&ctx->rds, callback_tmc);
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+}
+
+static void
+rdsparser_test_text_enabled(void **state)
+{
+    test_context_t *ctx = *state;
+
+    assert_int_equal(rdsparser_get_text_enabled(&ctx->rds, RDSPARSER_TEXT_PS), true);
+    assert_int_equal(rdsparser_get_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS), false);
+    assert_int_equal(rdsparser_get_text_enabled(&ctx->rds, RDSPARSER_TEXT_ERT), false);
+
+    /* Basic texts cannot be disabled */
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_PS, false), false);
+    assert_int_equal(rdsparser_get_text_enabled(&ctx->rds, RDSPARSER_TEXT_PS), true);
+
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS, true), true);
+    assert_int_equal(rdsparser_get_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS), true);
+    assert_int_equal(rdsparser_string_get_length(rdsparser_get_lps(&ctx->rds)), RDSPARSER_LPS_LENGTH);
+    assert_int_equal(rdsparser_string_get_available(rdsparser_get_lps(&ctx->rds)), false);
+
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_ERT, true), true);
+    assert_int_equal(rdsparser_string_get_length(rdsparser_get_ert(&ctx->rds)), RDSPARSER_ERT_LENGTH);
+
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS, false), true);
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_ERT, false), true);
+    assert_true(rdsparser_get_lps(&ctx->rds) == NULL);
+    assert_true(rdsparser_get_ert(&ctx->rds) == NULL);
+}
+
+static void
+rdsparser_test_deinit(void **state)
+{
+    test_context_t *ctx = *state;
+
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS, true), true);
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_ERT, true), true);
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    assert_int_equal(rdsparser_set_station_cache(&ctx->rds, RDSPARSER_STATION_CACHE_PI), true);
+#endif
+    assert_int_equal(rdsparser_set_events(&ctx->rds, true), true);
+
+    /* The optional buffers are released and the features disabled */
+    rdsparser_deinit(&ctx->rds);
+    assert_true(rdsparser_get_lps(&ctx->rds) == NULL);
+    assert_true(rdsparser_get_ert(&ctx->rds) == NULL);
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    assert_int_equal(rdsparser_get_station_cache(&ctx->rds), RDSPARSER_STATION_CACHE_OFF);
+#endif
+    assert_int_equal(rdsparser_get_events(&ctx->rds), false);
+
+    /* The context stays usable */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234567890123458"), true);
+    assert_int_equal(rdsparser_get_pi(&ctx->rds), 0x1234);
+    rdsparser_deinit(&ctx->rds);
+}
+
+static void
+rdsparser_test_string_get_utf8(void **state)
+{
+    test_context_t *ctx = *state;
+    char utf8[RDSPARSER_PS_LENGTH + 1];
+
+    assert_int_equal(rdsparser_string_get_encoding(rdsparser_get_ps(&ctx->rds)), RDSPARSER_STRING_ENCODING_BASIC);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234054C01205241"), true);
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_ps(&ctx->rds), utf8, sizeof(utf8)), RDSPARSER_PS_LENGTH);
+    assert_string_equal(utf8, "RA      ");
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_ps(&ctx->rds), utf8, 2), 1);
+    assert_string_equal(utf8, "R");
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_ps(&ctx->rds), utf8, 0), 0);
+}
+
+static void
+rdsparser_test_register_lps(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS, true);
+    rdsparser_register_lps(&ctx->rds, callback_lps);
+    expect_function_call(callback_lps);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F0004142434400"), true);
+    rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS, false);
+}
+
+static void
+rdsparser_test_lps_oda_announce(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS, true);
+    rdsparser_register_lps(&ctx->rds, callback_lps);
+
+    /* RT+ announced on 15A must not take over Long PS */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211301E00004BD700"), true);
+    expect_function_call(callback_lps);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F0004142434400"), true);
+    rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS, false);
+}
+
+static void
+rdsparser_test_register_ert(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_ERT, true);
+    rdsparser_register_ert(&ctx->rds, callback_ert);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321130180000655200"), true);
+    expect_function_call(callback_ert);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211C0004142434400"), true);
+    rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_ERT, false);
+}
+
+static void
+rdsparser_test_handlers_shared(void **state)
+{
+    test_context_t *ctx = *state;
+    static const rdsparser_handlers_t handlers = { .pi = callback_pi };
+    rdsparser_t *other = malloc(sizeof(rdsparser_t));
+    rdsparser_init(other);
+
+    rdsparser_set_handlers(&ctx->rds, &handlers);
+    rdsparser_set_handlers(other, &handlers);
+    rdsparser_set_user_data(&ctx->rds, ctx);
+    rdsparser_set_user_data(other, other);
+    assert_true(rdsparser_get_handlers(&ctx->rds) == &handlers);
+    assert_true(rdsparser_get_handlers(other) == &handlers);
+    assert_true(rdsparser_get_user_data(&ctx->rds) == ctx);
+    assert_true(rdsparser_get_user_data(other) == other);
+
+    expect_function_calls(callback_pi, 2);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234567890123458"), true);
+    assert_int_equal(rdsparser_parse_string(other, "1234567890123458"), true);
+
+    rdsparser_set_handlers(other, NULL);
+    free(other);
+}
+
+static void
+rdsparser_test_handlers_copy(void **state)
+{
+    test_context_t *ctx = *state;
+    static const rdsparser_handlers_t handlers = { .pi = callback_pi };
+    rdsparser_set_handlers(&ctx->rds, &handlers);
+
+    /* The shared set stays unchanged */
+    rdsparser_register_ps(&ctx->rds, callback_ps);
+    const rdsparser_handlers_t *own = rdsparser_get_handlers(&ctx->rds);
+    assert_true(own != &handlers);
+    assert_true(own->pi == callback_pi);
+    assert_true(own->ps == callback_ps);
+    assert_null(handlers.ps);
+
+    rdsparser_register_pi(&ctx->rds, NULL);
+    assert_true(rdsparser_get_handlers(&ctx->rds) == own);
+    assert_null(own->pi);
+    assert_true(handlers.pi == callback_pi);
+
+    expect_function_call(callback_ps);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "1234007890123458"), true);
+
+    rdsparser_set_handlers(&ctx->rds, NULL);
+    assert_null(rdsparser_get_handlers(&ctx->rds)->ps);
+
+    /* The private set is a part of the context and starts over */
+    rdsparser_register_pi(&ctx->rds, callback_pi);
+    assert_true(rdsparser_get_handlers(&ctx->rds) == own);
+    assert_true(own->pi == callback_pi);
+    assert_null(own->ps);
+}
 
 const struct CMUnitTest tests[] =
 {
@@ -521,6 +1534,13 @@ const struct CMUnitTest tests[] =
     cmocka_unit_test_setup_teardown(rdsparser_test_parse_string_invalid, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(rdsparser_test_parse_string_short, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(rdsparser_test_parse_string_long, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_parse_buffer, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_read_group, test_setup, test_teardown),
+#ifndef RDSPARSER_DISABLE_FILE
+    cmocka_unit_test_setup_teardown(rdsparser_test_parse_file, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_file_map, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_parse_file_log, test_setup, test_teardown),
+#endif
     cmocka_unit_test_setup_teardown(rdsparser_test_extended_check, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(rdsparser_test_ps_info_correction, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(rdsparser_test_ps_data_correction, test_setup, test_teardown),
@@ -536,13 +1556,56 @@ const struct CMUnitTest tests[] =
     cmocka_unit_test_setup_teardown(rdsparser_test_register_ta, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(rdsparser_test_register_ms, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(rdsparser_test_register_pty, test_setup, test_teardown),
+#ifndef RDSPARSER_DISABLE_GROUP1
     cmocka_unit_test_setup_teardown(rdsparser_test_register_ecc, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(rdsparser_test_register_country, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_pin, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_la, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_slc, test_setup, test_teardown),
+#endif
+#ifndef RDSPARSER_DISABLE_AF
     cmocka_unit_test_setup_teardown(rdsparser_test_register_af, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_af_ageing, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_af_expire, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_af_ageing_ticks, test_setup, test_teardown),
+#endif
+    cmocka_unit_test_setup_teardown(rdsparser_test_ttl, test_setup, test_teardown),
+#ifndef RDSPARSER_DISABLE_STATION_CACHE
+    cmocka_unit_test_setup_teardown(rdsparser_test_station_cache, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_station_cache_miss, test_setup, test_teardown),
+#endif
+    cmocka_unit_test_setup_teardown(rdsparser_test_events, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_events_text, test_setup, test_teardown),
+#if !defined(RDSPARSER_DISABLE_RT_B) && !defined(RDSPARSER_DISABLE_GROUP4)
+    cmocka_unit_test_setup_teardown(rdsparser_test_json, test_setup, test_teardown),
+#endif
+#ifndef RDSPARSER_DISABLE_GROUP4
+    cmocka_unit_test_setup_teardown(rdsparser_test_ct_filter, test_setup, test_teardown),
+#endif
     cmocka_unit_test_setup_teardown(rdsparser_test_register_ps, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(rdsparser_test_register_rt, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_rt_complete, test_setup, test_teardown),
+#ifndef RDSPARSER_DISABLE_GROUP10
     cmocka_unit_test_setup_teardown(rdsparser_test_register_ptyn, test_setup, test_teardown),
-    cmocka_unit_test_setup_teardown(rdsparser_test_register_ct, test_setup, test_teardown)
+    cmocka_unit_test_setup_teardown(rdsparser_test_ptyn_oda_announce, test_setup, test_teardown),
+#endif
+#ifndef RDSPARSER_DISABLE_GROUP4
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_ct, test_setup, test_teardown),
+#endif
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_eon, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_eon_ta, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_rtplus, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_oda_announce, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_oda, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_tmc, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_text_enabled, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_deinit, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_string_get_utf8, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_lps, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_lps_oda_announce, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_register_ert, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_handlers_shared, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rdsparser_test_handlers_copy, test_setup, test_teardown)
 };
 
 int
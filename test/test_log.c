@@ -0,0 +1,237 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "log.c"
+
+#define LOG_TEST_CAPACITY 4096
+
+static size_t
+log_test_write(uint8_t        *buffer,
+               uint16_t        sync_interval,
+               const uint64_t *times,
+               size_t          count)
+{
+    FILE *file = tmpfile();
+    assert_non_null(file);
+
+    rdsparser_log_writer_t writer;
+    assert_true(rdsparser_log_writer_init(&writer, file, sync_interval));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const rdsparser_data_t data = { 0x1234, (uint16_t)i, 0xABCD, 0xFFFF };
+        const rdsparser_error_t errors = { 0, (uint8_t)(i % 4), 2, 3 };
+        assert_true(rdsparser_log_write(&writer, times[i], data, errors));
+    }
+
+    const size_t length = (size_t)ftell(file);
+    assert_true(length <= LOG_TEST_CAPACITY);
+    rewind(file);
+    assert_int_equal(fread(buffer, 1, length, file), length);
+    fclose(file);
+    return length;
+}
+
+static void
+log_test_check(const rdsparser_data_t  data,
+               const rdsparser_error_t errors,
+               uint16_t                index)
+{
+    assert_int_equal(data[RDSPARSER_BLOCK_A], 0x1234);
+    assert_int_equal(data[RDSPARSER_BLOCK_B], index);
+    assert_int_equal(data[RDSPARSER_BLOCK_C], 0xABCD);
+    assert_int_equal(data[RDSPARSER_BLOCK_D], 0xFFFF);
+    assert_int_equal(errors[RDSPARSER_BLOCK_A], 0);
+    assert_int_equal(errors[RDSPARSER_BLOCK_B], index % 4);
+    assert_int_equal(errors[RDSPARSER_BLOCK_C], 2);
+    assert_int_equal(errors[RDSPARSER_BLOCK_D], 3);
+}
+
+static void
+log_test_round_trip(void **state)
+{
+    uint8_t buffer[LOG_TEST_CAPACITY];
+    uint64_t times[100];
+    for (size_t i = 0; i < 100; i++)
+    {
+        times[i] = 1700000000000ULL + i * 88 + (i == 50 ? 100000 : 0);
+    }
+
+    const size_t length = log_test_write(buffer, 16, times, 100);
+    assert_true(rdsparser_log_detect(buffer, length));
+
+    rdsparser_log_reader_t reader;
+    assert_true(rdsparser_log_reader_init(&reader, buffer, length));
+    assert_int_equal(reader.sync_interval, 16);
+
+    rdsparser_data_t data;
+    rdsparser_error_t errors;
+    uint64_t time;
+
+    for (uint16_t i = 0; i < 100; i++)
+    {
+        assert_true(rdsparser_log_read(&reader, data, errors, &time));
+        assert_int_equal(time, times[i]);
+        log_test_check(data, errors, i);
+    }
+
+    assert_false(rdsparser_log_read(&reader, data, errors, &time));
+}
+
+static void
+log_test_time_backwards(void **state)
+{
+    uint8_t buffer[LOG_TEST_CAPACITY];
+    const uint64_t times[4] = { 5000, 6000, 1000, 1088 };
+    const size_t length = log_test_write(buffer, 0, times, 4);
+
+    rdsparser_log_reader_t reader;
+    assert_true(rdsparser_log_reader_init(&reader, buffer, length));
+
+    rdsparser_data_t data;
+    rdsparser_error_t errors;
+    uint64_t time;
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        assert_true(rdsparser_log_read(&reader, data, errors, &time));
+        assert_int_equal(time, times[i]);
+    }
+
+    assert_false(rdsparser_log_read(&reader, data, errors, &time));
+}
+
+static void
+log_test_resync(void **state)
+{
+    uint8_t buffer[LOG_TEST_CAPACITY];
+    uint64_t times[12];
+    for (size_t i = 0; i < 12; i++)
+    {
+        times[i] = i * 100;
+    }
+
+    /* Header, sync, 4 records, sync, 4 records, sync, 4 records */
+    const size_t length = log_test_write(buffer, 4, times, 12);
+    const size_t first = RDSPARSER_LOG_HEADER_SIZE + RDSPARSER_LOG_SYNC_SIZE;
+
+    /* Drop the second record of the first block */
+    const size_t record = 1 + RDSPARSER_LOG_RECORD_SIZE;
+    for (size_t i = first + record; i < length - record; i++)
+    {
+        buffer[i] = buffer[i + record];
+    }
+
+    rdsparser_log_reader_t reader;
+    assert_true(rdsparser_log_reader_init(&reader, buffer, length - record));
+
+    rdsparser_data_t data;
+    rdsparser_error_t errors;
+    uint64_t time;
+    const uint16_t expected[] = { 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++)
+    {
+        assert_true(rdsparser_log_read(&reader, data, errors, &time));
+        log_test_check(data, errors, expected[i]);
+    }
+
+    assert_false(rdsparser_log_read(&reader, data, errors, &time));
+}
+
+static void
+log_test_truncated(void **state)
+{
+    uint8_t buffer[LOG_TEST_CAPACITY];
+    uint64_t times[8];
+    for (size_t i = 0; i < 8; i++)
+    {
+        times[i] = i * 100;
+    }
+
+    const size_t length = log_test_write(buffer, 4, times, 8);
+
+    rdsparser_log_reader_t reader;
+    assert_true(rdsparser_log_reader_init(&reader, buffer, length - 3));
+
+    rdsparser_data_t data;
+    rdsparser_error_t errors;
+    uint64_t time;
+
+    for (uint16_t i = 0; i < 7; i++)
+    {
+        assert_true(rdsparser_log_read(&reader, data, errors, &time));
+        log_test_check(data, errors, i);
+    }
+
+    assert_false(rdsparser_log_read(&reader, data, errors, &time));
+}
+
+static void
+log_test_parse_time(void **state)
+{
+    uint8_t buffer[LOG_TEST_CAPACITY];
+    const uint64_t times[] = { 1000, 2000, 9000 };
+    const size_t length = log_test_write(buffer, 4, times, 3);
+
+    rdsparser_t rds;
+    rdsparser_init(&rds);
+    rdsparser_set_ttl(&rds, RDSPARSER_FIELD_PI, 5000);
+
+    assert_int_equal(rdsparser_parse_log(&rds, buffer, length), 3);
+    assert_int_equal(rdsparser_get_time(&rds), 9000);
+    assert_int_equal(rdsparser_get_last_seen(&rds, RDSPARSER_FIELD_PI), 9000);
+    assert_int_equal(rdsparser_get_pi(&rds), 0x1234);
+}
+
+static void
+log_test_detect(void **state)
+{
+    const uint8_t log[] = { 'R', 'D', 'S', 'L', 1, 0, 64, 0 };
+    const uint8_t future[] = { 'R', 'D', 'S', 'L', 2, 0, 64, 0 };
+    const uint8_t hex[] = "34DB2400E20D2020";
+    rdsparser_log_reader_t reader;
+
+    assert_true(rdsparser_log_detect(log, sizeof(log)));
+    assert_false(rdsparser_log_detect(log, sizeof(log) - 1));
+    assert_false(rdsparser_log_detect(hex, sizeof(hex) - 1));
+    assert_true(rdsparser_log_reader_init(&reader, log, sizeof(log)));
+    assert_false(rdsparser_log_reader_init(&reader, future, sizeof(future)));
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(log_test_round_trip, NULL, NULL),
+    cmocka_unit_test_setup_teardown(log_test_time_backwards, NULL, NULL),
+    cmocka_unit_test_setup_teardown(log_test_resync, NULL, NULL),
+    cmocka_unit_test_setup_teardown(log_test_truncated, NULL, NULL),
+    cmocka_unit_test_setup_teardown(log_test_parse_time, NULL, NULL),
+    cmocka_unit_test_setup_teardown(log_test_detect, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,158 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "oda.c"
+
+static int
+test_setup(void **state)
+{
+    rdsparser_oda_t *oda = malloc(sizeof(rdsparser_oda_t));
+    rdsparser_oda_init(oda);
+    *state = oda;
+    return 0;
+}
+
+static int
+test_teardown(void **state)
+{
+    free(*state);
+    return 0;
+}
+
+static void
+callback_oda(rdsparser_t             *rds,
+             uint16_t                 aid,
+             const rdsparser_data_t   data,
+             const rdsparser_error_t  errors,
+             void                    *user_data)
+{
+}
+
+static void
+oda_test_announce(void **state)
+{
+    rdsparser_oda_t *oda = *state;
+    const uint8_t index = RDSPARSER_ODA_INDEX(11, RDSPARSER_GROUP_FLAG_A);
+
+    assert_int_equal(rdsparser_oda_announce(oda, index, 0x4BD7), true);
+    assert_int_equal(oda->group[index].aid, 0x4BD7);
+    assert_int_equal(oda->group[index].handler, RDSPARSER_ODA_HANDLER_NONE);
+    /* Same value */
+    assert_int_equal(rdsparser_oda_announce(oda, index, 0x4BD7), false);
+}
+
+static void
+oda_test_announce_fixed_group(void **state)
+{
+    rdsparser_oda_t *oda = *state;
+
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(0, RDSPARSER_GROUP_FLAG_A), 0x4BD7), false);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(2, RDSPARSER_GROUP_FLAG_B), 0x4BD7), false);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(3, RDSPARSER_GROUP_FLAG_A), 0x4BD7), false);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(3, RDSPARSER_GROUP_FLAG_B), 0x4BD7), true);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(10, RDSPARSER_GROUP_FLAG_A), 0x4BD7), false);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(10, RDSPARSER_GROUP_FLAG_B), 0x4BD7), true);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(14, RDSPARSER_GROUP_FLAG_A), 0x4BD7), false);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(15, RDSPARSER_GROUP_FLAG_A), 0x4BD7), false);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_INDEX(15, RDSPARSER_GROUP_FLAG_B), 0x4BD7), false);
+    assert_int_equal(rdsparser_oda_announce(oda, RDSPARSER_ODA_GROUP_COUNT, 0x4BD7), false);
+}
+
+static void
+oda_test_register_before_announce(void **state)
+{
+    rdsparser_oda_t *oda = *state;
+    const uint8_t index = RDSPARSER_ODA_INDEX(12, RDSPARSER_GROUP_FLAG_A);
+
+    assert_int_equal(rdsparser_oda_register(oda, 0x1234, callback_oda), true);
+    assert_int_equal(rdsparser_oda_announce(oda, index, 0x1234), true);
+    assert_int_equal(oda->group[index].handler, 0);
+}
+
+static void
+oda_test_register_after_announce(void **state)
+{
+    rdsparser_oda_t *oda = *state;
+    const uint8_t index = RDSPARSER_ODA_INDEX(12, RDSPARSER_GROUP_FLAG_A);
+
+    assert_int_equal(rdsparser_oda_announce(oda, index, 0x1234), true);
+    assert_int_equal(rdsparser_oda_register(oda, 0x5678, callback_oda), true);
+    assert_int_equal(rdsparser_oda_register(oda, 0x1234, callback_oda), true);
+    assert_int_equal(oda->group[index].handler, 1);
+}
+
+static void
+oda_test_register_existing(void **state)
+{
+    rdsparser_oda_t *oda = *state;
+
+    assert_int_equal(rdsparser_oda_register(oda, 0x1234, callback_oda), true);
+    assert_int_equal(rdsparser_oda_register(oda, 0x1234, NULL), true);
+    assert_int_equal(oda->handler_count, 1);
+    assert_true(oda->handler[0].callback == NULL);
+}
+
+static void
+oda_test_register_full(void **state)
+{
+    rdsparser_oda_t *oda = *state;
+
+    for (uint16_t i = 0; i < RDSPARSER_ODA_HANDLER_COUNT; i++)
+    {
+        assert_int_equal(rdsparser_oda_register(oda, 0x1000 + i, callback_oda), true);
+    }
+
+    assert_int_equal(rdsparser_oda_register(oda, 0x2000, callback_oda), false);
+}
+
+static void
+oda_test_clear(void **state)
+{
+    rdsparser_oda_t *oda = *state;
+    const uint8_t index = RDSPARSER_ODA_INDEX(12, RDSPARSER_GROUP_FLAG_A);
+
+    assert_int_equal(rdsparser_oda_register(oda, 0x1234, callback_oda), true);
+    assert_int_equal(rdsparser_oda_announce(oda, index, 0x1234), true);
+
+    /* Announcements are cleared, handlers are kept */
+    rdsparser_oda_clear(oda);
+    assert_int_equal(oda->group[index].aid, RDSPARSER_ODA_AID_NONE);
+    assert_int_equal(oda->handler_count, 1);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(oda_test_announce, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(oda_test_announce_fixed_group, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(oda_test_register_before_announce, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(oda_test_register_after_announce, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(oda_test_register_existing, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(oda_test_register_full, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(oda_test_clear, test_setup, test_teardown)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,55 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "pin.c"
+
+static void
+pin_test_fields(void **state)
+{
+    /* 20th, 23:05 */
+    const rdsparser_pin_t pin = (20 << 11) | (23 << 6) | 5;
+
+    assert_int_equal(rdsparser_pin_get_day(pin), 20);
+    assert_int_equal(rdsparser_pin_get_hour(pin), 23);
+    assert_int_equal(rdsparser_pin_get_minute(pin), 5);
+}
+
+static void
+pin_test_unknown(void **state)
+{
+    assert_int_equal(rdsparser_pin_get_day(RDSPARSER_PIN_UNKNOWN), 0);
+    assert_int_equal(rdsparser_pin_get_hour(RDSPARSER_PIN_UNKNOWN), 0);
+    assert_int_equal(rdsparser_pin_get_minute(RDSPARSER_PIN_UNKNOWN), 0);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(pin_test_fields, NULL, NULL),
+    cmocka_unit_test_setup_teardown(pin_test_unknown, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
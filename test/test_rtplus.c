@@ -0,0 +1,155 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "rtplus.c"
+
+static int
+test_setup(void **state)
+{
+    rdsparser_rtplus_t *rtplus = malloc(sizeof(rdsparser_rtplus_t));
+    rdsparser_rtplus_clear(rtplus);
+    *state = rtplus;
+    return 0;
+}
+
+static int
+test_teardown(void **state)
+{
+    free(*state);
+    return 0;
+}
+
+static void
+rtplus_test_get_toggle(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xB018;
+
+    assert_int_equal(rdsparser_rtplus_get_toggle(data), true);
+}
+
+static void
+rtplus_test_get_running(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xB008;
+
+    assert_int_equal(rdsparser_rtplus_get_running(data), true);
+}
+
+static void
+rtplus_test_get_tag1(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xB008;
+    data[2] = 0x8006;
+
+    assert_int_equal(rdsparser_rtplus_get_type1(data), RDSPARSER_RTPLUS_ITEM_ARTIST);
+    assert_int_equal(rdsparser_rtplus_get_start1(data), 0);
+    assert_int_equal(rdsparser_rtplus_get_length1(data), 4);
+}
+
+static void
+rtplus_test_get_tag2(void **state)
+{
+    rdsparser_data_t data;
+    data[2] = 0x8006;
+    data[3] = 0x0883;
+
+    assert_int_equal(rdsparser_rtplus_get_type2(data), RDSPARSER_RTPLUS_ITEM_TITLE);
+    assert_int_equal(rdsparser_rtplus_get_start2(data), 4);
+    assert_int_equal(rdsparser_rtplus_get_length2(data), 4);
+}
+
+static void
+rtplus_test_get_type_max(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0xB007;
+    data[2] = 0xE001;
+    data[3] = 0xF800;
+
+    assert_int_equal(rdsparser_rtplus_get_type1(data), RDSPARSER_RTPLUS_GET_DATA);
+    assert_int_equal(rdsparser_rtplus_get_type2(data), RDSPARSER_RTPLUS_GET_DATA);
+}
+
+static void
+rtplus_test_update_tag(void **state)
+{
+    rdsparser_rtplus_t *rtplus = *state;
+    rdsparser_rtplus_tag_t *tag;
+
+    assert_int_equal(rdsparser_rtplus_update_tag(rtplus, RDSPARSER_RTPLUS_ITEM_TITLE, 4, 10, RDSPARSER_RT_FLAG_A, &tag), true);
+    assert_true(tag == &rtplus->tag[0]);
+    assert_int_equal(rtplus->count, 1);
+    assert_int_equal(rdsparser_rtplus_update_tag(rtplus, RDSPARSER_RTPLUS_ITEM_TITLE, 4, 10, RDSPARSER_RT_FLAG_A, &tag), false);
+    assert_int_equal(rdsparser_rtplus_update_tag(rtplus, RDSPARSER_RTPLUS_ITEM_TITLE, 4, 10, RDSPARSER_RT_FLAG_B, &tag), true);
+    assert_int_equal(rdsparser_rtplus_update_tag(rtplus, RDSPARSER_RTPLUS_ITEM_TITLE, 4, 11, RDSPARSER_RT_FLAG_B, &tag), true);
+    assert_int_equal(rtplus->count, 1);
+}
+
+static void
+rtplus_test_update_tag_invalid(void **state)
+{
+    rdsparser_rtplus_t *rtplus = *state;
+    rdsparser_rtplus_tag_t *tag;
+
+    assert_int_equal(rdsparser_rtplus_update_tag(rtplus, RDSPARSER_RTPLUS_DUMMY_CLASS, 0, 4, RDSPARSER_RT_FLAG_A, &tag), false);
+    assert_int_equal(rdsparser_rtplus_update_tag(rtplus, RDSPARSER_RTPLUS_ITEM_TITLE, 60, 5, RDSPARSER_RT_FLAG_A, &tag), false);
+    assert_int_equal(rtplus->count, 0);
+}
+
+static void
+rtplus_test_update_tag_full(void **state)
+{
+    rdsparser_rtplus_t *rtplus = *state;
+    rdsparser_rtplus_tag_t *tag;
+
+    for (uint8_t i = 0; i <= RDSPARSER_RTPLUS_TAG_COUNT; i++)
+    {
+        assert_int_equal(rdsparser_rtplus_update_tag(rtplus, 1 + i, 0, 1, RDSPARSER_RT_FLAG_A, &tag), true);
+    }
+
+    /* The oldest tag is replaced */
+    assert_int_equal(rtplus->count, RDSPARSER_RTPLUS_TAG_COUNT);
+    assert_int_equal(rtplus->tag[0].type, 2);
+    assert_int_equal(rtplus->tag[RDSPARSER_RTPLUS_TAG_COUNT - 1].type, 1 + RDSPARSER_RTPLUS_TAG_COUNT);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(rtplus_test_get_toggle, NULL, NULL),
+    cmocka_unit_test_setup_teardown(rtplus_test_get_running, NULL, NULL),
+    cmocka_unit_test_setup_teardown(rtplus_test_get_tag1, NULL, NULL),
+    cmocka_unit_test_setup_teardown(rtplus_test_get_tag2, NULL, NULL),
+    cmocka_unit_test_setup_teardown(rtplus_test_get_type_max, NULL, NULL),
+    cmocka_unit_test_setup_teardown(rtplus_test_update_tag, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rtplus_test_update_tag_invalid, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(rtplus_test_update_tag_full, test_setup, test_teardown)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,100 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "station.c"
+
+static int
+station_setup(void **state)
+{
+    rdsparser_station_table_t *table = malloc(sizeof(rdsparser_station_table_t));
+    rdsparser_station_table_init(table);
+    *state = table;
+    return 0;
+}
+
+static int
+station_teardown(void **state)
+{
+    free(*state);
+    return 0;
+}
+
+static void
+station_test_lookup(void **state)
+{
+    rdsparser_station_table_t *table = *state;
+
+    assert_null(rdsparser_station_table_lookup(table, 0x1234, 0));
+    rdsparser_station_t *station = rdsparser_station_table_insert(table, 0x1234, 0);
+    assert_non_null(station);
+    assert_int_equal(station->pi, 0x1234);
+    assert_int_equal(table->count, 1);
+
+    assert_true(rdsparser_station_table_insert(table, 0x1234, 0) == station);
+    assert_true(rdsparser_station_table_lookup(table, 0x1234, 0) == station);
+    assert_int_equal(table->count, 1);
+
+    /* Same PI on another frequency */
+    assert_null(rdsparser_station_table_lookup(table, 0x1234, 101900));
+    assert_true(rdsparser_station_table_insert(table, 0x1234, 101900) != station);
+    assert_int_equal(table->count, 2);
+
+    rdsparser_station_table_clear(table);
+    assert_int_equal(table->count, 0);
+    assert_null(rdsparser_station_table_lookup(table, 0x1234, 0));
+}
+
+static void
+station_test_eviction(void **state)
+{
+    rdsparser_station_table_t *table = *state;
+
+    for (uint16_t i = 0; i < RDSPARSER_STATION_CACHE_SIZE; i++)
+    {
+        rdsparser_station_table_insert(table, 0x1000 + i, 0);
+    }
+    assert_int_equal(table->count, RDSPARSER_STATION_CACHE_SIZE);
+
+    /* The oldest entry is used again, the second one is evicted */
+    assert_non_null(rdsparser_station_table_lookup(table, 0x1000, 0));
+    rdsparser_station_table_insert(table, 0x2000, 0);
+    assert_int_equal(table->count, RDSPARSER_STATION_CACHE_SIZE);
+
+    assert_non_null(rdsparser_station_table_lookup(table, 0x1000, 0));
+    assert_null(rdsparser_station_table_lookup(table, 0x1001, 0));
+    assert_non_null(rdsparser_station_table_lookup(table, 0x1002, 0));
+    assert_non_null(rdsparser_station_table_lookup(table, 0x2000, 0));
+    assert_int_equal(table->entry[table->order[0]].pi, 0x2000);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(station_test_lookup, station_setup, station_teardown),
+    cmocka_unit_test_setup_teardown(station_test_eviction, station_setup, station_teardown)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
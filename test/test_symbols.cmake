@@ -0,0 +1,91 @@
+# Compares the dynamic symbols of the shared library with the API of librdsparser.h
+#
+# Usage: cmake -DLIBRARY=<librdsparser.so> -DHEADER=<librdsparser.h> -DNM=<nm>
+#              [-DDISABLED=<FEATURE,...>] -P test/test_symbols.cmake
+#
+# Declarations behind #ifndef RDSPARSER_DISABLE_<FEATURE> are skipped
+# for the features given in DISABLED.
+
+string(REPLACE "," ";" DISABLED "${DISABLED}")
+
+# Expected: RDSPARSER_API declarations of the enabled features
+file(READ ${HEADER} CONTENT)
+string(REPLACE ";" "" CONTENT "${CONTENT}")
+string(REPLACE "\n" ";" LINES "${CONTENT}")
+
+set(EXPECTED)
+set(STACK)
+set(SKIP 0)
+foreach(LINE ${LINES})
+    if(LINE MATCHES "^#if")
+        set(STATE 0)
+        if(LINE MATCHES "^#ifndef RDSPARSER_DISABLE_([A-Z0-9_]+)")
+            list(FIND DISABLED ${CMAKE_MATCH_1} INDEX)
+            if(NOT INDEX EQUAL -1)
+                set(STATE 1)
+            else()
+                set(STATE 2)
+            endif()
+        endif()
+        list(APPEND STACK ${STATE})
+    elseif(LINE MATCHES "^#else")
+        list(LENGTH STACK LENGTH)
+        math(EXPR LAST "${LENGTH} - 1")
+        list(GET STACK ${LAST} STATE)
+        list(REMOVE_AT STACK ${LAST})
+        if(STATE EQUAL 1)
+            set(STATE 2)
+        elseif(STATE EQUAL 2)
+            set(STATE 1)
+        endif()
+        list(APPEND STACK ${STATE})
+    elseif(LINE MATCHES "^#endif")
+        list(LENGTH STACK LENGTH)
+        math(EXPR LAST "${LENGTH} - 1")
+        list(REMOVE_AT STACK ${LAST})
+    elseif(LINE MATCHES "^RDSPARSER_API .*[ *](rdsparser_[a-z0-9_]+)\\(")
+        list(FIND STACK 1 INDEX)
+        if(INDEX EQUAL -1)
+            list(APPEND EXPECTED ${CMAKE_MATCH_1})
+        endif()
+    endif()
+endforeach()
+
+# Actual: defined global symbols in the dynamic symbol table
+execute_process(COMMAND ${NM} -D --defined-only ${LIBRARY}
+                OUTPUT_VARIABLE OUTPUT
+                RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "${NM} failed for ${LIBRARY}")
+endif()
+
+string(REPLACE "\n" ";" LINES "${OUTPUT}")
+set(EXPORTED)
+foreach(LINE ${LINES})
+    if(LINE MATCHES " [BDGRST] ([A-Za-z0-9_]+)$")
+        list(APPEND EXPORTED ${CMAKE_MATCH_1})
+    endif()
+endforeach()
+
+set(UNEXPECTED ${EXPORTED})
+set(MISSING ${EXPECTED})
+if(EXPECTED)
+    list(REMOVE_ITEM UNEXPECTED ${EXPECTED})
+endif()
+if(EXPORTED)
+    list(REMOVE_ITEM MISSING ${EXPORTED})
+endif()
+
+# Symbols of the toolchain itself
+list(FILTER UNEXPECTED EXCLUDE REGEX "^_")
+
+list(LENGTH EXPECTED COUNT)
+message(STATUS "${COUNT} functions in the public API")
+
+if(UNEXPECTED OR MISSING)
+    string(REPLACE ";" "\n  " UNEXPECTED "${UNEXPECTED}")
+    string(REPLACE ";" "\n  " MISSING "${MISSING}")
+    message(FATAL_ERROR "Exported symbols do not match the public API\n"
+                        "Not in librdsparser.h:\n  ${UNEXPECTED}\n"
+                        "Not exported:\n  ${MISSING}")
+endif()
@@ -0,0 +1,217 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "tmc.c"
+
+static int
+test_setup(void **state)
+{
+    rdsparser_tmc_t *tmc = malloc(sizeof(rdsparser_tmc_t));
+    rdsparser_tmc_clear(tmc);
+    *state = tmc;
+    return 0;
+}
+
+static int
+test_teardown(void **state)
+{
+    free(*state);
+    return 0;
+}
+
+static void
+tmc_test_get_single(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0x800A;
+
+    assert_int_equal(rdsparser_tmc_get_tuning(data), false);
+    assert_int_equal(rdsparser_tmc_get_single(data), true);
+    assert_int_equal(rdsparser_tmc_get_dp_ci(data), 2);
+}
+
+static void
+tmc_test_get_tuning(void **state)
+{
+    rdsparser_data_t data;
+    data[1] = 0x8010;
+
+    assert_int_equal(rdsparser_tmc_get_tuning(data), true);
+}
+
+static void
+tmc_test_get_message(void **state)
+{
+    rdsparser_data_t data;
+    data[2] = 0xD065;
+    data[3] = 0x1234;
+
+    assert_int_equal(rdsparser_tmc_get_diversion(data), true);
+    assert_int_equal(rdsparser_tmc_get_direction(data), true);
+    assert_int_equal(rdsparser_tmc_get_extent(data), 2);
+    assert_int_equal(rdsparser_tmc_get_event(data), 0x065);
+    assert_int_equal(rdsparser_tmc_get_location(data), 0x1234);
+}
+
+static void
+tmc_test_get_subsequent(void **state)
+{
+    rdsparser_data_t data;
+    data[2] = 0x6ABC;
+    data[3] = 0xDEF0;
+
+    assert_int_equal(rdsparser_tmc_get_first(data), false);
+    assert_int_equal(rdsparser_tmc_get_second(data), true);
+    assert_int_equal(rdsparser_tmc_get_gsi(data), 2);
+    assert_int_equal(rdsparser_tmc_get_free(data), 0xABCDEF0);
+}
+
+static void
+tmc_test_get_free_duration(void **state)
+{
+    /* Label 0, duration 5 */
+    uint32_t free[1] = { 0x0A00000 };
+    assert_int_equal(rdsparser_tmc_get_free_duration(free, 1), 5);
+}
+
+static void
+tmc_test_get_free_duration_after_label(void **state)
+{
+    /* Label 1 (3 bits), label 0 with duration 6 */
+    uint32_t free[1] = { 0x1E18000 };
+    assert_int_equal(rdsparser_tmc_get_free_duration(free, 1), 6);
+}
+
+static void
+tmc_test_get_free_duration_split(void **state)
+{
+    /* Label 10 (16 bits), label 9 (11 bits) and
+       label 0 with duration 7 spread over two groups */
+    uint32_t free[2] = { 0xAFFFF9F, 0xFE1C000 };
+    assert_int_equal(rdsparser_tmc_get_free_duration(free, 2), 7);
+    assert_int_equal(rdsparser_tmc_get_free_duration(free, 1), 0);
+}
+
+static void
+tmc_test_push(void **state)
+{
+    rdsparser_tmc_t *tmc = *state;
+    rdsparser_tmc_message_t message = { 101, 0x1234, 2, 2, true, false, false };
+
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 0, RDSPARSER_TMC_WINDOW), true);
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 0, RDSPARSER_TMC_WINDOW), false);
+
+    message.duration = 3;
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 0, RDSPARSER_TMC_WINDOW), true);
+    assert_int_equal((uint8_t)(tmc->head - tmc->tail), 2);
+}
+
+static void
+tmc_test_push_overflow(void **state)
+{
+    rdsparser_tmc_t *tmc = *state;
+    rdsparser_tmc_message_t message = { 0, 0x1234, 0, 0, false, false, false };
+
+    for (uint16_t i = 0; i < RDSPARSER_TMC_QUEUE_SIZE + 2; i++)
+    {
+        message.event = i;
+        rdsparser_tmc_push(tmc, &message, 0, RDSPARSER_TMC_WINDOW);
+    }
+
+    assert_int_equal((uint8_t)(tmc->head - tmc->tail), RDSPARSER_TMC_QUEUE_SIZE);
+    assert_int_equal(tmc->overflow, 2);
+    /* The oldest messages are dropped */
+    assert_int_equal(tmc->queue[tmc->tail % RDSPARSER_TMC_QUEUE_SIZE].event, 2);
+}
+
+static void
+tmc_test_push_window(void **state)
+{
+    rdsparser_tmc_t *tmc = *state;
+    rdsparser_tmc_message_t message = { 101, 0x1234, 2, 2, true, false, false };
+
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 100, 10), true);
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 110, 10), false);
+    /* Each repeat keeps the message alive */
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 120, 10), false);
+    /* Issued again after it was not broadcast for the whole window */
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 131, 10), true);
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 132, 10), false);
+}
+
+static void
+tmc_test_push_window_wrap(void **state)
+{
+    rdsparser_tmc_t *tmc = *state;
+    rdsparser_tmc_message_t message = { 101, 0x1234, 2, 2, true, false, false };
+
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, UINT32_MAX - 5, 10), true);
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 4, 10), false);
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 15, 10), true);
+}
+
+static void
+tmc_test_push_zero(void **state)
+{
+    rdsparser_tmc_t *tmc = *state;
+    /* Every field zero */
+    rdsparser_tmc_message_t message = { 0, 0, 0, 0, false, false, false };
+
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 0, RDSPARSER_TMC_WINDOW), true);
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 0, RDSPARSER_TMC_WINDOW), false);
+}
+
+static void
+tmc_test_clear(void **state)
+{
+    rdsparser_tmc_t *tmc = *state;
+    rdsparser_tmc_message_t message = { 101, 0x1234, 2, 2, true, false, false };
+
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 0, RDSPARSER_TMC_WINDOW), true);
+    rdsparser_tmc_clear(tmc);
+    assert_int_equal(tmc->head, tmc->tail);
+    assert_int_equal(rdsparser_tmc_push(tmc, &message, 0, RDSPARSER_TMC_WINDOW), true);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(tmc_test_get_single, NULL, NULL),
+    cmocka_unit_test_setup_teardown(tmc_test_get_tuning, NULL, NULL),
+    cmocka_unit_test_setup_teardown(tmc_test_get_message, NULL, NULL),
+    cmocka_unit_test_setup_teardown(tmc_test_get_subsequent, NULL, NULL),
+    cmocka_unit_test_setup_teardown(tmc_test_get_free_duration, NULL, NULL),
+    cmocka_unit_test_setup_teardown(tmc_test_get_free_duration_after_label, NULL, NULL),
+    cmocka_unit_test_setup_teardown(tmc_test_get_free_duration_split, NULL, NULL),
+    cmocka_unit_test_setup_teardown(tmc_test_push, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(tmc_test_push_overflow, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(tmc_test_push_window, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(tmc_test_push_window_wrap, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(tmc_test_push_zero, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(tmc_test_clear, test_setup, test_teardown)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,91 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "ttl.c"
+
+static void
+ttl_test_disabled(void **state)
+{
+    rdsparser_ttl_t ttl = { 0 };
+    rdsparser_ttl_clear(&ttl);
+
+    rdsparser_ttl_touch(&ttl, RDSPARSER_FIELD_PS, 100);
+    assert_int_equal(ttl.deadline, RDSPARSER_TTL_DEADLINE_NONE);
+    assert_int_equal(rdsparser_ttl_check(&ttl, UINT64_MAX - 1), 0);
+}
+
+static void
+ttl_test_expiry(void **state)
+{
+    rdsparser_ttl_t ttl = { 0 };
+    rdsparser_ttl_clear(&ttl);
+    rdsparser_ttl_set(&ttl, RDSPARSER_FIELD_TA, 1000);
+    rdsparser_ttl_set(&ttl, RDSPARSER_FIELD_RT, 3000);
+
+    rdsparser_ttl_touch(&ttl, RDSPARSER_FIELD_TA, 0);
+    rdsparser_ttl_touch(&ttl, RDSPARSER_FIELD_RT, 0);
+    assert_int_equal(rdsparser_ttl_check(&ttl, 500), 0);
+    assert_int_equal(ttl.deadline, 1000);
+
+    /* Refresh does not require a scan */
+    rdsparser_ttl_touch(&ttl, RDSPARSER_FIELD_TA, 800);
+    assert_int_equal(ttl.deadline, 1000);
+    assert_int_equal(rdsparser_ttl_check(&ttl, 1000), 0);
+    assert_int_equal(ttl.deadline, 1800);
+
+    assert_int_equal(rdsparser_ttl_check(&ttl, 1800), 1 << RDSPARSER_FIELD_TA);
+    assert_int_equal(ttl.deadline, 3000);
+    assert_int_equal(rdsparser_ttl_check(&ttl, 5000), (1 << RDSPARSER_FIELD_TA) | (1 << RDSPARSER_FIELD_RT));
+    assert_int_equal(ttl.deadline, RDSPARSER_TTL_DEADLINE_NONE);
+
+    /* Re-armed by a new value */
+    rdsparser_ttl_touch(&ttl, RDSPARSER_FIELD_RT, 6000);
+    assert_int_equal(ttl.deadline, 9000);
+}
+
+static void
+ttl_test_set(void **state)
+{
+    rdsparser_ttl_t ttl = { 0 };
+    rdsparser_ttl_clear(&ttl);
+    rdsparser_ttl_set(&ttl, RDSPARSER_FIELD_PI, 10000);
+    rdsparser_ttl_touch(&ttl, RDSPARSER_FIELD_PI, 1000);
+    assert_int_equal(rdsparser_ttl_check(&ttl, 2000), 0);
+
+    /* Shorter TTL is applied on the next check */
+    rdsparser_ttl_set(&ttl, RDSPARSER_FIELD_PI, 500);
+    assert_int_equal(rdsparser_ttl_check(&ttl, 2000), 1 << RDSPARSER_FIELD_PI);
+}
+
+const struct CMUnitTest tests[] =
+{
+    cmocka_unit_test_setup_teardown(ttl_test_disabled, NULL, NULL),
+    cmocka_unit_test_setup_teardown(ttl_test_expiry, NULL, NULL),
+    cmocka_unit_test_setup_teardown(ttl_test_set, NULL, NULL)
+};
+
+int
+main(void)
+{
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -47,6 +47,11 @@ typedef struct {
     uint8_t ct_hour;
     uint8_t ct_minute;
     int16_t ct_offset;
+    int64_t ct_epoch;
+    rdsparser_pi_t eon_pi;
+    rdsparser_ta_t eon_ta;
+    wchar_t eon_ps[9];
+    wchar_t rtplus[RDSPARSER_RTPLUS_TYPE_COUNT][65];
 } test_context_t;
 
 static int
@@ -78,7 +83,7 @@ static int
 test_teardown(void **state)
 {
     test_context_t *ctx = *state;
-    (void)ctx;
+    rdsparser_deinit(&ctx->rds);
     return 0;
 }
 
@@ -127,6 +132,7 @@ callback_ms(rdsparser_t *rds,
     function_called();
 }
 
+#ifndef RDSPARSER_DISABLE_GROUP1
 static void
 callback_ecc(rdsparser_t *rds,
              void        *user_data)
@@ -144,7 +150,9 @@ callback_country(rdsparser_t *rds,
     assert_int_equal(rdsparser_get_country(rds), ctx->country);
     function_called();
 }
+#endif
 
+#ifndef RDSPARSER_DISABLE_AF
 static void
 callback_af(rdsparser_t *rds,
             uint32_t     new_af,
@@ -155,6 +163,7 @@ callback_af(rdsparser_t *rds,
     ctx->af1 = ctx->af2;
     function_called();
 }
+#endif
 
 static void
 callback_ps(rdsparser_t *rds,
@@ -179,6 +188,16 @@ callback_rt(rdsparser_t         *rds,
     function_called();
 }
 
+static void
+callback_rt_complete(rdsparser_t         *rds,
+                     rdsparser_rt_flag_t  flag,
+                     void                *user_data)
+{
+    check_expected(flag);
+    function_called();
+}
+
+#ifndef RDSPARSER_DISABLE_GROUP10
 static void
 callback_ptyn(rdsparser_t *rds,
               void        *user_data)
@@ -189,23 +208,121 @@ callback_ptyn(rdsparser_t *rds,
     assert_rds_string_equal(content, ctx->ptyn);
     function_called();
 }
+#endif
+
+static void
+callback_eon(rdsparser_t           *rds,
+             const rdsparser_eon_t *eon,
+             void                  *user_data)
+{
+    test_context_t *ctx = (test_context_t*)user_data;
+    assert_int_equal(rdsparser_eon_get_pi(eon), ctx->eon_pi);
+    assert_rds_string_equal(rdsparser_string_get_content(rdsparser_eon_get_ps(eon)), ctx->eon_ps);
+    function_called();
+}
+
+static void
+callback_eon_ta(rdsparser_t           *rds,
+                const rdsparser_eon_t *eon,
+                void                  *user_data)
+{
+    test_context_t *ctx = (test_context_t*)user_data;
+    assert_int_equal(rdsparser_eon_get_pi(eon), ctx->eon_pi);
+    assert_int_equal(rdsparser_eon_get_ta(eon), ctx->eon_ta);
+    function_called();
+}
+
+static void
+callback_rtplus(rdsparser_t                  *rds,
+                const rdsparser_rtplus_tag_t *tag,
+                void                         *user_data)
+{
+    test_context_t *ctx = (test_context_t*)user_data;
+    const rdsparser_rtplus_type_t type = rdsparser_rtplus_tag_get_type(tag);
+    const uint8_t length = rdsparser_rtplus_tag_get_length(tag);
+    rdsparser_string_char_t content[RDSPARSER_RT_LENGTH + 1];
+
+    for (uint8_t i = 0; i < length; i++)
+    {
+        content[i] = rdsparser_rtplus_tag_get_content(rds, tag)[i];
+    }
+
+    content[length] = '\0';
+    check_expected(type);
+    assert_rds_string_equal(content, ctx->rtplus[type]);
+    function_called();
+}
+
+static void
+callback_oda_announce(rdsparser_t *rds,
+                      uint8_t      group,
+                      bool         flag,
+                      uint16_t     aid,
+                      void        *user_data)
+{
+    check_expected(group);
+    check_expected(flag);
+    check_expected(aid);
+    function_called();
+}
+
+static void
+callback_oda(rdsparser_t             *rds,
+             uint16_t                 aid,
+             const rdsparser_data_t   data,
+             const rdsparser_error_t  errors,
+             void                    *user_data)
+{
+    uint16_t value = data[RDSPARSER_BLOCK_D];
+    check_expected(aid);
+    check_expected(value);
+    function_called();
+}
+
+static void
+callback_tmc(rdsparser_t *rds,
+             void        *user_data)
+{
+    function_called();
+}
 
+static void
+callback_lps(rdsparser_t *rds,
+             void        *user_data)
+{
+    function_called();
+}
+
+static void
+callback_ert(rdsparser_t *rds,
+             void        *user_data)
+{
+    function_called();
+}
+
+#ifndef RDSPARSER_DISABLE_GROUP4
 static void
 callback_ct(rdsparser_t          *rds,
             const rdsparser_ct_t *ct,
             void                 *user_data)
 {
     test_context_t *ctx = (test_context_t*)user_data;
-
-    assert_int_equal(rdsparser_ct_get_year(ct), ctx->ct_year);
-    assert_int_equal(rdsparser_ct_get_month(ct), ctx->ct_month);
-    assert_int_equal(rdsparser_ct_get_day(ct), ctx->ct_day);
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+
+    rdsparser_ct_get_date(ct, &year, &month, &day);
+    assert_int_equal(year, ctx->ct_year);
+    assert_int_equal(month, ctx->ct_month);
+    assert_int_equal(day, ctx->ct_day);
     assert_int_equal(rdsparser_ct_get_hour(ct), ctx->ct_hour);
     assert_int_equal(rdsparser_ct_get_minute(ct), ctx->ct_minute);
     assert_int_equal(rdsparser_ct_get_offset(ct), ctx->ct_offset);
+    assert_int_equal(rdsparser_ct_get_epoch(ct), ctx->ct_epoch);
 
     function_called();
 }
+#endif
 
 /* ------------------------------------------------ */
 
@@ -445,6 +562,7 @@ verification_ms_invalid(void **state)
     assert_int_equal(rdsparser_get_ms(&ctx->rds), RDSPARSER_MS_UNKNOWN);
 }
 
+#ifndef RDSPARSER_DISABLE_GROUP1
 static void
 verification_ecc(void **state)
 {
@@ -521,7 +639,9 @@ verification_country_extended_check(void **state)
     assert_int_equal(rdsparser_get_country(&ctx->rds), RDSPARSER_COUNTRY_UNKNOWN);
     verification_ecc(state);
 }
+#endif
 
+#ifndef RDSPARSER_DISABLE_AF
 static void
 verification_af(void **state)
 {
@@ -593,6 +713,7 @@ verification_af_extended_check(void **state)
 
     verification_af(state);
 }
+#endif
 
 static void
 check_ps(test_context_t *ctx,
@@ -619,6 +740,14 @@ verification_ps(void **state)
     check_ps(ctx, "1234054A01203E3F", L":;<=>?  ");
     check_ps(ctx, "1234054F01204AF2", L":;<=>?Jæ");
 
+    char utf8[RDSPARSER_PS_LENGTH * 3 + 1];
+    rdsparser_string_get_utf8(rdsparser_get_ps(&ctx->rds), utf8, sizeof(utf8));
+#ifndef RDSPARSER_DISABLE_UNICODE
+    assert_string_equal(utf8, ":;<=>?J\xC3\xA6");
+#else
+    assert_string_equal(utf8, ":;<=>?J ");
+#endif
+
     rdsparser_clear(&ctx->rds);
     assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_ps(&ctx->rds)), L"        ");
 }
@@ -789,13 +918,16 @@ verification_rt_a(void **state)
     check_rt(ctx, "34DB254E3634203600", L"KRDP Plock ul. Tumska 3 (I pietro) Tel do redakcji: 24 264 6    ", RDSPARSER_RT_FLAG_A);
     check_rt(ctx, "34DB254F3420303000", L"KRDP Plock ul. Tumska 3 (I pietro) Tel do redakcji: 24 264 64 00", RDSPARSER_RT_FLAG_A);
 
+#ifndef RDSPARSER_DISABLE_RT_B
     assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_rt(&ctx->rds, RDSPARSER_RT_FLAG_B)), empty);
+#endif
 
     rdsparser_clear(&ctx->rds);
     assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_rt(&ctx->rds, RDSPARSER_RT_FLAG_A)), empty);
     assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_rt(&ctx->rds, RDSPARSER_RT_FLAG_B)), empty);
 }
 
+#ifndef RDSPARSER_DISABLE_RT_B
 static void
 verification_rt_b(void **state)
 {
@@ -826,6 +958,80 @@ verification_rt_b(void **state)
     assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_rt(&ctx->rds, RDSPARSER_RT_FLAG_A)), empty);
     assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_rt(&ctx->rds, RDSPARSER_RT_FLAG_B)), empty);
 }
+#endif
+
+static void
+verification_rt_complete(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_rt_complete(&ctx->rds, callback_rt_complete);
+
+    /* Line ending in the second segment */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB254120500D2000"), true);
+    assert_int_equal(rdsparser_get_rt_complete(&ctx->rds, RDSPARSER_RT_FLAG_A), false);
+
+    expect_value(callback_rt_complete, flag, RDSPARSER_RT_FLAG_A);
+    expect_function_call(callback_rt_complete);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB25404B52445000"), true);
+    assert_int_equal(rdsparser_get_rt_complete(&ctx->rds, RDSPARSER_RT_FLAG_A), true);
+
+    /* Repeated segments, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB25404B52445000"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB254120500D2000"), true);
+
+    /* Changed text without the line ending needs all segments */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB25414142434400"), true);
+    assert_int_equal(rdsparser_get_rt_complete(&ctx->rds, RDSPARSER_RT_FLAG_A), false);
+
+    /* Flag toggle starts over */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB25504B52445000"), true);
+    expect_value(callback_rt_complete, flag, RDSPARSER_RT_FLAG_B);
+    expect_function_call(callback_rt_complete);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB255120500D2000"), true);
+
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_get_rt_complete(&ctx->rds, RDSPARSER_RT_FLAG_B), false);
+}
+
+static void
+verification_rt_complete_switch(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_rt_complete(&ctx->rds, callback_rt_complete);
+
+    /* Code table switch in the first segment */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB25400E0E4B5200"), true);
+    assert_int_equal(rdsparser_get_rt_complete(&ctx->rds, RDSPARSER_RT_FLAG_A), false);
+
+    expect_value(callback_rt_complete, flag, RDSPARSER_RT_FLAG_A);
+    expect_function_call(callback_rt_complete);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB254120500D2000"), true);
+    assert_int_equal(rdsparser_get_rt_complete(&ctx->rds, RDSPARSER_RT_FLAG_A), true);
+    assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_rt(&ctx->rds, RDSPARSER_RT_FLAG_A)), L"  KR P");
+    assert_int_equal(rdsparser_string_get_errors(rdsparser_get_rt(&ctx->rds, RDSPARSER_RT_FLAG_A))[0], RDSPARSER_STRING_ERROR_NONE);
+}
+
+static void
+verification_rt_complete_threshold(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_rt_complete(&ctx->rds, callback_rt_complete);
+
+    rdsparser_set_text_correction(&ctx->rds, RDSPARSER_TEXT_RT, RDSPARSER_BLOCK_TYPE_INFO, RDSPARSER_BLOCK_ERROR_LARGE);
+    rdsparser_set_text_correction(&ctx->rds, RDSPARSER_TEXT_RT, RDSPARSER_BLOCK_TYPE_DATA, RDSPARSER_BLOCK_ERROR_LARGE);
+
+    /* Corrected segment is not enough by default */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB25404B52445014"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB254120500D2000"), true);
+    assert_int_equal(rdsparser_get_rt_complete(&ctx->rds, RDSPARSER_RT_FLAG_A), false);
+
+    rdsparser_set_rt_complete_threshold(&ctx->rds, RDSPARSER_STRING_ERROR_MEDIUM_SMALL);
+    assert_int_equal(rdsparser_get_rt_complete_threshold(&ctx->rds), RDSPARSER_STRING_ERROR_MEDIUM_SMALL);
+
+    expect_value(callback_rt_complete, flag, RDSPARSER_RT_FLAG_A);
+    expect_function_call(callback_rt_complete);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "34DB25404B52445014"), true);
+}
 
 static void
 verification_rt_invalid(void **state)
@@ -947,6 +1153,7 @@ verification_rt_empty_with_error(void **state)
     assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_rt(&ctx->rds, RDSPARSER_RT_FLAG_A)), empty);
 }
 
+#ifndef RDSPARSER_DISABLE_GROUP10
 static void
 verification_ptyn(void **state)
 {
@@ -970,7 +1177,9 @@ verification_ptyn(void **state)
     rdsparser_clear(&ctx->rds);
     assert_rds_string_equal(rdsparser_string_get_content(rdsparser_get_ptyn(&ctx->rds)), L"        ");
 }
+#endif
 
+#ifndef RDSPARSER_DISABLE_GROUP4
 static void
 verification_ct(void **state)
 {
@@ -983,11 +1192,396 @@ verification_ct(void **state)
     ctx->ct_hour = 1;
     ctx->ct_minute = 6;
     ctx->ct_offset = 60;
+    ctx->ct_epoch = 1705622760;
 
     expect_function_call(callback_ct);
     assert_int_equal(rdsparser_parse_string(&ctx->rds, "23534541D7500182"), true);
 }
 
+static void
+verification_ct_filter(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_ct(&ctx->rds, callback_ct);
+    rdsparser_set_ct_filter(&ctx->rds, true);
+
+    /* First time is held as a candidate */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "23534541D7500182"), true);
+
+    /* About a minute of other groups */
+    for (int i = 0; i < 684; i++)
+    {
+        assert_int_equal(rdsparser_parse_string(&ctx->rds, "2353000000000000"), true);
+    }
+
+    ctx->ct_year = 2024;
+    ctx->ct_month = 1;
+    ctx->ct_day = 19;
+    ctx->ct_hour = 1;
+    ctx->ct_minute = 7;
+    ctx->ct_offset = 60;
+    ctx->ct_epoch = 1705622820;
+
+    expect_function_call(callback_ct);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "23534541D75001C2"), true);
+
+    /* Corrupted date, ignored */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "23534541D75201C2"), true);
+}
+#endif
+
+static void
+verification_eon(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_eon(&ctx->rds, callback_eon);
+    ctx->eon_pi = 0x3201;
+
+    expect_function_call(callback_eon);
+    swprintf(ctx->eon_ps, sizeof(ctx->eon_ps), L"RA      ");
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E0005241320100"), true);
+    /* Same value, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E0005241320100"), true);
+
+    expect_function_call(callback_eon);
+    swprintf(ctx->eon_ps, sizeof(ctx->eon_ps), L"RADI    ");
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E0014449320100"), true);
+
+#ifndef RDSPARSER_DISABLE_AF
+    /* AF(ON) */
+    expect_function_call(callback_eon);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E0040102320100"), true);
+#endif
+
+    /* Mapped frequency */
+    expect_function_call(callback_eon);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E0050A1E320100"), true);
+
+    /* PTY(ON) */
+    expect_function_call(callback_eon);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E00D5000320100"), true);
+
+    /* TP(ON) */
+    expect_function_call(callback_eon);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E01D5000320100"), true);
+
+    /* Invalid PI(ON), ignored */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E0014F20320101"), true);
+
+    const rdsparser_eon_t *eon = rdsparser_get_eon_pi(&ctx->rds, 0x3201);
+    assert_true(eon != NULL);
+    assert_true(rdsparser_get_eon(&ctx->rds, 0) == eon);
+    assert_int_equal(rdsparser_get_eon_count(&ctx->rds), 1);
+    assert_int_equal(rdsparser_eon_get_pty(eon), 10);
+    assert_int_equal(rdsparser_eon_get_tp(eon), true);
+#ifndef RDSPARSER_DISABLE_AF
+    assert_int_equal(rdsparser_af_count(rdsparser_eon_get_af(eon)), 2);
+#endif
+    assert_int_equal(rdsparser_eon_get_mapped(eon, 88500), 90500);
+
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_get_eon_count(&ctx->rds), 0);
+    assert_true(rdsparser_get_eon_pi(&ctx->rds, 0x3201) == NULL);
+}
+
+static void
+verification_eon_ta(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_eon_ta(&ctx->rds, callback_eon_ta);
+    ctx->eon_pi = 0x3201;
+
+    /* Group 14B */
+    expect_function_call(callback_eon_ta);
+    ctx->eon_ta = true;
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E8183211320100"), true);
+    /* Same value, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E8183211320100"), true);
+
+    /* Group 14A, variant 13 */
+    expect_function_call(callback_eon_ta);
+    ctx->eon_ta = false;
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211E01D5000320100"), true);
+}
+
+static void
+verification_rtplus(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_rtplus(&ctx->rds, callback_rtplus);
+    swprintf(ctx->rtplus[RDSPARSER_RTPLUS_ITEM_ARTIST], 65, L"ABCD");
+    swprintf(ctx->rtplus[RDSPARSER_RTPLUS_ITEM_TITLE], 65, L"EFGH");
+
+    /* RadioText */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321120004142434400"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321120014546474800"), true);
+
+    /* RT+ is carried in group 11A */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211301600004BD700"), true);
+
+    expect_value(callback_rtplus, type, RDSPARSER_RTPLUS_ITEM_ARTIST);
+    expect_function_call(callback_rtplus);
+    expect_value(callback_rtplus, type, RDSPARSER_RTPLUS_ITEM_TITLE);
+    expect_function_call(callback_rtplus);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211B0088006088300"), true);
+    /* Same value, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211B0088006088300"), true);
+
+    assert_int_equal(rdsparser_get_rtplus_count(&ctx->rds), 2);
+    assert_int_equal(rdsparser_get_rtplus_running(&ctx->rds), true);
+
+    /* Only the title tag covers the changed segment */
+    expect_value(callback_rtplus, type, RDSPARSER_RTPLUS_ITEM_TITLE);
+    expect_function_call(callback_rtplus);
+    swprintf(ctx->rtplus[RDSPARSER_RTPLUS_ITEM_TITLE], 65, L"WXYZ");
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321120015758595A00"), true);
+    /* Same value, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321120015758595A00"), true);
+
+    const rdsparser_rtplus_tag_t *tag = rdsparser_get_rtplus_type(&ctx->rds, RDSPARSER_RTPLUS_ITEM_TITLE);
+    assert_true(tag != NULL);
+    assert_int_equal(rdsparser_rtplus_tag_get_start(tag), 4);
+    assert_int_equal(rdsparser_rtplus_tag_get_length(tag), 4);
+    assert_int_equal(rdsparser_rtplus_tag_get_flag(tag), RDSPARSER_RT_FLAG_A);
+
+    /* Item toggle, tags are received again */
+    expect_value(callback_rtplus, type, RDSPARSER_RTPLUS_ITEM_ARTIST);
+    expect_function_call(callback_rtplus);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211B0188006000000"), true);
+    assert_int_equal(rdsparser_get_rtplus_count(&ctx->rds), 1);
+
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_get_rtplus_count(&ctx->rds), 0);
+}
+
+static void
+verification_oda(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_oda_announce(&ctx->rds, callback_oda_announce);
+    assert_int_equal(rdsparser_register_oda(&ctx->rds, 0x1234, callback_oda), true);
+
+    /* Not announced yet, ignored */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211C000000000AA00"), true);
+
+    /* Group 12A */
+    expect_value(callback_oda_announce, group, 12);
+    expect_value(callback_oda_announce, flag, false);
+    expect_value(callback_oda_announce, aid, 0x1234);
+    expect_function_call(callback_oda_announce);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321130180000123400"), true);
+    /* Same value, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321130180000123400"), true);
+    assert_int_equal(rdsparser_get_oda(&ctx->rds, 12, false), 0x1234);
+    assert_int_equal(rdsparser_get_oda(&ctx->rds, 12, true), 0);
+
+    expect_value(callback_oda, aid, 0x1234);
+    expect_value(callback_oda, value, 0x00AA);
+    expect_function_call(callback_oda);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211C000000000AA00"), true);
+
+    /* Invalid group type, ignored */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211C000000000AA10"), true);
+
+    /* Fixed group type, ignored */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321130000000123400"), true);
+    assert_int_equal(rdsparser_get_oda(&ctx->rds, 0, false), 0);
+
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_get_oda(&ctx->rds, 12, false), 0);
+}
+
+static void
+verification_tmc(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_tmc_message_t messages[RDSPARSER_TMC_QUEUE_SIZE];
+    rdsparser_register_tmc(&ctx->rds, callback_tmc);
+
+    /* Single group message */
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+    /* Repeated message, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+
+    /* Invalid data, ignored */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5066123401"), true);
+
+    /* Multi group message, duration in the second group */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321180038873234500"), true);
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800340A0000000"), true);
+
+    /* Multi group message, missing second group */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321180048874234500"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800400A0000000"), true);
+
+    assert_int_equal(rdsparser_get_tmc_pending(&ctx->rds), 2);
+    assert_int_equal(rdsparser_tmc_drain(&ctx->rds, messages, 1), 1);
+    assert_int_equal(messages[0].event, 0x065);
+    assert_int_equal(messages[0].location, 0x1234);
+    assert_int_equal(messages[0].extent, 2);
+    assert_int_equal(messages[0].duration, 2);
+    assert_int_equal(messages[0].direction, true);
+    assert_int_equal(messages[0].diversion, false);
+    assert_int_equal(messages[0].multi_group, false);
+
+    assert_int_equal(rdsparser_tmc_drain(&ctx->rds, messages, RDSPARSER_TMC_QUEUE_SIZE), 1);
+    assert_int_equal(messages[0].event, 0x073);
+    assert_int_equal(messages[0].location, 0x2345);
+    assert_int_equal(messages[0].extent, 1);
+    assert_int_equal(messages[0].duration, 5);
+    assert_int_equal(messages[0].direction, false);
+    assert_int_equal(messages[0].multi_group, true);
+
+    assert_int_equal(rdsparser_tmc_drain(&ctx->rds, messages, RDSPARSER_TMC_QUEUE_SIZE), 0);
+    assert_int_equal(rdsparser_get_tmc_overflow(&ctx->rds), 0);
+}
+
+static void
+verification_tmc_duration(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_tmc_message_t messages[RDSPARSER_TMC_QUEUE_SIZE];
+    rdsparser_register_tmc(&ctx->rds, callback_tmc);
+
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+    /* Same blocks C and D, duration changed in block B */
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800B5065123400"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800B5065123400"), true);
+
+    assert_int_equal(rdsparser_tmc_drain(&ctx->rds, messages, RDSPARSER_TMC_QUEUE_SIZE), 2);
+    assert_int_equal(messages[0].duration, 2);
+    assert_int_equal(messages[1].duration, 3);
+}
+
+static void
+verification_tmc_window(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_tmc(&ctx->rds, callback_tmc);
+    assert_int_equal(rdsparser_get_tmc_window(&ctx->rds), RDSPARSER_TMC_WINDOW);
+    rdsparser_set_tmc_window(&ctx->rds, 2);
+    assert_int_equal(rdsparser_get_tmc_window(&ctx->rds), 2);
+
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5066123400"), true);
+    /* Repeated within the window */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+
+    /* Not broadcast for longer than the window */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321100000000000000"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321100000000000000"), true);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321100000000000000"), true);
+
+    /* Issued again */
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5066123400"), true);
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+    assert_int_equal(rdsparser_get_tmc_pending(&ctx->rds), 4);
+}
+
+static void
+verification_tmc_oda(void **state)
+{
+    test_context_t *ctx = *state;
+    rdsparser_register_tmc(&ctx->rds, callback_tmc);
+
+    /* TMC announced in group 3A */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321130100000CD4600"), true);
+
+    expect_function_call(callback_tmc);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211800A5065123400"), true);
+    assert_int_equal(rdsparser_get_tmc_pending(&ctx->rds), 1);
+
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_get_tmc_pending(&ctx->rds), 0);
+}
+
+static void
+verification_lps(void **state)
+{
+    test_context_t *ctx = *state;
+    char utf8[RDSPARSER_LPS_LENGTH + 1];
+    rdsparser_register_lps(&ctx->rds, callback_lps);
+
+    /* Disabled by default */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F000C3A96C6100"), true);
+    assert_true(rdsparser_get_lps(&ctx->rds) == NULL);
+
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_LPS, true), true);
+    assert_int_equal(rdsparser_string_get_encoding(rdsparser_get_lps(&ctx->rds)), RDSPARSER_STRING_ENCODING_UTF8);
+
+    expect_function_call(callback_lps);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F000C3A96C6100"), true);
+    /* Same value, no callback */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F000C3A96C6100"), true);
+
+    /* Multi-byte characters only from error-free data */
+    rdsparser_set_text_correction(&ctx->rds, RDSPARSER_TEXT_LPS, RDSPARSER_BLOCK_TYPE_DATA, RDSPARSER_BLOCK_ERROR_SMALL);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F001C3A9C3A905"), true);
+
+    expect_function_call(callback_lps);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F0010D00000000"), true);
+
+    assert_int_equal(rdsparser_string_get_length(rdsparser_get_lps(&ctx->rds)), 4);
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_lps(&ctx->rds), utf8, sizeof(utf8)), 4);
+    assert_string_equal(utf8, "\xC3\xA9la");
+
+    /* Truncated output */
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_lps(&ctx->rds), utf8, 3), 2);
+    assert_string_equal(utf8, "\xC3\xA9");
+
+    /* Never in the middle of a sequence */
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_lps(&ctx->rds), utf8, 2), 0);
+    assert_string_equal(utf8, "");
+
+    /* Invalid sequences are replaced with U+FFFD */
+    expect_function_call(callback_lps);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F000FFC3414200"), true);
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_lps(&ctx->rds), utf8, sizeof(utf8)), 8);
+    assert_string_equal(utf8, "\xEF\xBF\xBD\xEF\xBF\xBD" "AB");
+    expect_function_call(callback_lps);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211F000E282414200"), true);
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_lps(&ctx->rds), utf8, sizeof(utf8)), 5);
+    assert_string_equal(utf8, "\xEF\xBF\xBD" "AB");
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_lps(&ctx->rds), utf8, 3), 0);
+
+    rdsparser_clear(&ctx->rds);
+    assert_int_equal(rdsparser_string_get_available(rdsparser_get_lps(&ctx->rds)), false);
+}
+
+static void
+verification_ert(void **state)
+{
+    test_context_t *ctx = *state;
+    char utf8[RDSPARSER_ERT_LENGTH + 1];
+    rdsparser_register_ert(&ctx->rds, callback_ert);
+    assert_int_equal(rdsparser_set_text_enabled(&ctx->rds, RDSPARSER_TEXT_ERT, true), true);
+
+    /* Not announced yet, ignored */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211C000C5BB6F6C00"), true);
+
+    /* eRT announced in group 3A, carried in 12A */
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "321130180000655200"), true);
+
+    expect_function_call(callback_ert);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211C000C5BB6F6C00"), true);
+    expect_function_call(callback_ert);
+    assert_int_equal(rdsparser_parse_string(&ctx->rds, "3211C01F0D00000000"), true);
+
+    /* Terminated in the last segment */
+    assert_int_equal(rdsparser_string_get_utf8(rdsparser_get_ert(&ctx->rds), utf8, sizeof(utf8)), RDSPARSER_ERT_LENGTH - 4);
+    utf8[4] = '\0';
+    assert_string_equal(utf8, "\xC5\xBBol");
+}
+
 const struct CMUnitTest tests[] =
 {
     cmocka_unit_test_setup_teardown(verification_pi, test_setup, test_teardown),
@@ -1008,15 +1602,19 @@ const struct CMUnitTest tests[] =
     cmocka_unit_test_setup_teardown(verification_ms_false, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_ms_invalid, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_ms_extended_check, test_setup, test_teardown),
+#ifndef RDSPARSER_DISABLE_GROUP1
     cmocka_unit_test_setup_teardown(verification_ecc, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_ecc_invalid, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_ecc_extended_check, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_country, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_country_invalid, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_country_extended_check, test_setup, test_teardown),
+#endif
+#ifndef RDSPARSER_DISABLE_AF
     cmocka_unit_test_setup_teardown(verification_af, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_af_invalid, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_af_extended_check, test_setup, test_teardown),
+#endif
     cmocka_unit_test_setup_teardown(verification_ps, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_ps_invalid, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_ps_invalid_pos, test_setup, test_teardown),
@@ -1025,14 +1623,34 @@ const struct CMUnitTest tests[] =
     cmocka_unit_test_setup_teardown(verification_ps_with_large_errors, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_ps_progressive, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_rt_a, test_setup, test_teardown),
+#ifndef RDSPARSER_DISABLE_RT_B
     cmocka_unit_test_setup_teardown(verification_rt_b, test_setup, test_teardown),
+#endif
+    cmocka_unit_test_setup_teardown(verification_rt_complete, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_rt_complete_switch, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_rt_complete_threshold, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_rt_invalid, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_rt_invalid_pos, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_rt_invalid_data, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_rt_empty, test_setup, test_teardown),
     cmocka_unit_test_setup_teardown(verification_rt_empty_with_error, test_setup, test_teardown),
+#ifndef RDSPARSER_DISABLE_GROUP10
     cmocka_unit_test_setup_teardown(verification_ptyn, test_setup, test_teardown),
-    cmocka_unit_test_setup_teardown(verification_ct, test_setup, test_teardown)
+#endif
+#ifndef RDSPARSER_DISABLE_GROUP4
+    cmocka_unit_test_setup_teardown(verification_ct, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_ct_filter, test_setup, test_teardown),
+#endif
+    cmocka_unit_test_setup_teardown(verification_eon, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_eon_ta, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_rtplus, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_oda, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_tmc, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_tmc_duration, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_tmc_window, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_tmc_oda, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_lps, test_setup, test_teardown),
+    cmocka_unit_test_setup_teardown(verification_ert, test_setup, test_teardown)
 };
 
 int
@@ -0,0 +1,366 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <librdsparser.h>
+
+#define BENCH_GROUPS 200000
+#define BENCH_RUNS 20
+/* PPPPBBBBCCCCDDDDEE and the line feed */
+#define BENCH_LINE_LENGTH 19
+/* About a minute at 11.4 groups per second */
+#define BENCH_CT_INTERVAL 684
+#define BENCH_RT_INTERVAL 512
+
+#define BENCH_PI 0x3211
+#define BENCH_PTY 10
+
+typedef struct bench_capture
+{
+    char *data;
+    size_t length;
+    bool mapped;
+} bench_capture_t;
+
+static double
+bench_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint16_t
+bench_chars(uint32_t *seed)
+{
+    uint16_t chars = 0;
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        *seed = *seed * 1103515245u + 12345u;
+        chars = (uint16_t)((chars << 8) | (0x20 + (*seed >> 16) % 0x5F));
+    }
+
+    return chars;
+}
+
+static void
+bench_group(size_t   index,
+            uint32_t seed,
+            uint16_t data[4],
+            uint8_t *errors)
+{
+    /* Every second group carries RadioText, like on a typical station */
+    static const uint8_t schedule[16] = { 0, 2, 0, 2, 0, 2, 0, 2, 1, 2, 10, 2, 8, 2, 0, 2 };
+    const uint8_t type = schedule[index % 16];
+    const size_t cycle = index / 16;
+    const uint16_t b = (uint16_t)((BENCH_PTY << 5) | (1 << 10));
+    const uint32_t rt_seed = seed + (uint32_t)(index / BENCH_RT_INTERVAL);
+
+    data[0] = BENCH_PI;
+    *errors = 0;
+
+    if (index % BENCH_CT_INTERVAL == BENCH_CT_INTERVAL - 1)
+    {
+        /* 4A, MJD 60000 with one minute per group */
+        const uint32_t mjd = 60000;
+        const uint32_t minute = (uint32_t)(index / BENCH_CT_INTERVAL) % (24 * 60);
+        data[1] = (uint16_t)(0x4000 | b | (mjd >> 15));
+        data[2] = (uint16_t)(((mjd & 0x7FFF) << 1) | ((minute / 60) >> 4));
+        data[3] = (uint16_t)((((minute / 60) & 0x0F) << 12) | ((minute % 60) << 6) | 2);
+        return;
+    }
+
+    switch (type)
+    {
+        case 0:
+        {
+            static const char ps[] = "BENCH FM";
+            const uint8_t segment = (uint8_t)((index / 2) % 4);
+            data[1] = (uint16_t)(b | 0x0008 | segment);
+            data[2] = (uint16_t)(((segment == 0) ? 0xE400 : ((2 * segment - 1) << 8)) | (2 * segment + 1));
+            data[3] = (uint16_t)((ps[segment * 2] << 8) | ps[segment * 2 + 1]);
+            break;
+        }
+
+        case 2:
+        {
+            const uint8_t segment = (uint8_t)((index / 2) % 16);
+            uint32_t chars = rt_seed * 16 + segment;
+            data[1] = (uint16_t)(0x2000 | b | ((rt_seed & 1) << 4) | segment);
+            data[2] = bench_chars(&chars);
+            data[3] = bench_chars(&chars);
+            break;
+        }
+
+        case 1:
+            data[1] = (uint16_t)(0x1000 | b);
+            data[2] = 0x00E2;
+            data[3] = 0xF8C0;
+            break;
+
+        case 10:
+        {
+            static const char ptyn[] = "BENCHMRK";
+            const uint8_t segment = (uint8_t)(cycle % 2);
+            data[1] = (uint16_t)(0xA000 | b | segment);
+            data[2] = (uint16_t)((ptyn[segment * 4] << 8) | ptyn[segment * 4 + 1]);
+            data[3] = (uint16_t)((ptyn[segment * 4 + 2] << 8) | ptyn[segment * 4 + 3]);
+            break;
+        }
+
+        default:
+            /* Single group TMC message, each one sent twice */
+            data[1] = (uint16_t)(0x8000 | b | 0x0008 | 2);
+            data[2] = (uint16_t)(0x5000 | (cycle / 2) % 0x800);
+            data[3] = 0x1234;
+            break;
+    }
+
+    /* Corrected and uncorrectable blocks */
+    if (index % 16 == 15)
+    {
+        *errors = 0x05;
+    }
+    else if (index % 64 == 31)
+    {
+        *errors = 0x03;
+    }
+}
+
+static bool
+bench_generate(bench_capture_t *capture,
+               size_t           groups)
+{
+    capture->length = groups * BENCH_LINE_LENGTH;
+    capture->data = malloc(capture->length + 1);
+    capture->mapped = false;
+
+    if (capture->data == NULL)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < groups; i++)
+    {
+        uint16_t data[4];
+        uint8_t errors;
+        bench_group(i, 0x5EED, data, &errors);
+        snprintf(capture->data + i * BENCH_LINE_LENGTH, BENCH_LINE_LENGTH + 1,
+                 "%04X%04X%04X%04X%02X\n", data[0], data[1], data[2], data[3], errors);
+    }
+
+    return true;
+}
+
+static bool
+bench_write(const bench_capture_t *capture,
+            const char            *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    const bool written = (fwrite(capture->data, 1, capture->length, file) == capture->length);
+    return (fclose(file) == 0 && written);
+}
+
+static bool
+bench_open(bench_capture_t *capture,
+           const char      *path)
+{
+    const char *data;
+    if (!rdsparser_file_map(path, &data, &capture->length))
+    {
+        return false;
+    }
+
+    capture->data = (char*)data;
+    capture->mapped = true;
+    return true;
+}
+
+static void
+bench_close(bench_capture_t *capture)
+{
+    if (capture->mapped)
+    {
+        rdsparser_file_unmap(capture->data, capture->length);
+    }
+    else
+    {
+        free(capture->data);
+    }
+}
+
+static int64_t
+bench_run(const bench_capture_t *capture,
+          double                *elapsed)
+{
+#ifdef RDSPARSER_DISABLE_HEAP
+    rdsparser_t buffer;
+    rdsparser_init(&buffer);
+    rdsparser_t *rds = &buffer;
+#else
+    rdsparser_t *rds = rdsparser_new();
+    if (rds == NULL)
+    {
+        return -1;
+    }
+#endif
+
+    const double start = bench_time();
+    const size_t count = rdsparser_parse_buffer(rds, capture->data, capture->length);
+    *elapsed = bench_time() - start;
+
+#ifndef RDSPARSER_DISABLE_HEAP
+    rdsparser_free(rds);
+#endif
+
+    return (int64_t)count;
+}
+
+static int
+bench_report(const char            *name,
+             const bench_capture_t *capture,
+             unsigned int           runs)
+{
+    double best = 0;
+    double total = 0;
+    int64_t count = 0;
+
+    for (unsigned int i = 0; i < runs; i++)
+    {
+        double elapsed;
+        count = bench_run(capture, &elapsed);
+        if (count < 0)
+        {
+            fprintf(stderr, "%s: unable to create the context\n", name);
+            return -1;
+        }
+
+        total += elapsed;
+        if (i == 0 ||
+            elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    printf("%s: %lld groups, best %.2f ns/group (%.0f groups/s), mean %.2f ns/group\n",
+           name,
+           (long long)count,
+           (count > 0) ? best * 1e9 / count : 0.0,
+           (best > 0) ? count / best : 0.0,
+           (count > 0) ? total * 1e9 / runs / count : 0.0);
+    return 0;
+}
+
+static void
+bench_usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-n RUNS] [-g GROUPS] [-w OUTPUT] [FILE...]\n", name);
+    fprintf(stderr, "  -n RUNS    parse each capture RUNS times and report the best run (default %d)\n", BENCH_RUNS);
+    fprintf(stderr, "  -g GROUPS  size of the generated capture, used without FILE (default %d)\n", BENCH_GROUPS);
+    fprintf(stderr, "  -w OUTPUT  also write the generated capture\n");
+}
+
+int
+main(int   argc,
+     char *argv[])
+{
+    unsigned int runs = BENCH_RUNS;
+    size_t groups = BENCH_GROUPS;
+    const char *output = NULL;
+    bench_capture_t capture;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:g:w:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                runs = (unsigned int)strtoul(optarg, NULL, 10);
+                break;
+
+            case 'g':
+                groups = (size_t)strtoull(optarg, NULL, 10);
+                break;
+
+            case 'w':
+                output = optarg;
+                break;
+
+            default:
+                bench_usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (runs == 0 ||
+        groups == 0)
+    {
+        bench_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (optind >= argc)
+    {
+        if (!bench_generate(&capture, groups))
+        {
+            fprintf(stderr, "%s: unable to generate the capture\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        if (output &&
+            !bench_write(&capture, output))
+        {
+            fprintf(stderr, "%s: unable to write the file\n", output);
+            bench_close(&capture);
+            return EXIT_FAILURE;
+        }
+
+        const int status = bench_report("generated", &capture, runs);
+        bench_close(&capture);
+        return (status == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    int status = EXIT_SUCCESS;
+    for (int i = optind; i < argc; i++)
+    {
+        if (!bench_open(&capture, argv[i]))
+        {
+            fprintf(stderr, "%s: unable to read the file\n", argv[i]);
+            status = EXIT_FAILURE;
+            continue;
+        }
+
+        if (bench_report(argv[i], &capture, runs) != 0)
+        {
+            status = EXIT_FAILURE;
+        }
+
+        bench_close(&capture);
+    }
+
+    return status;
+}
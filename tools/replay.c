@@ -0,0 +1,572 @@
+/*  SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ *  librdsparser – Radio Data System parser library
+ *  Copyright (C) 2024  Konrad Kosmatka
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <librdsparser.h>
+
+/* Group duration: 104 bits at 1187.5 bps */
+#define REPLAY_GROUP_NS 87578947L
+
+typedef struct replay_options
+{
+    bool quiet;
+    bool realtime;
+    rdsparser_log_writer_t *writer;
+} replay_options_t;
+
+typedef struct replay_job
+{
+    const char *path;
+    char *output;
+    size_t output_size;
+    int64_t count;
+    double elapsed;
+    bool done;
+} replay_job_t;
+
+typedef struct replay_pool
+{
+    const replay_options_t *options;
+    replay_job_t *jobs;
+    size_t count;
+    size_t next;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+} replay_pool_t;
+
+typedef struct replay_worker
+{
+    replay_pool_t *pool;
+    pthread_t thread;
+    size_t files;
+    double busy;
+} replay_worker_t;
+
+typedef struct replay_input
+{
+    const char *data;
+    size_t length;
+    bool binary;
+    rdsparser_log_reader_t reader;
+    const char *line;
+    uint64_t index;
+} replay_input_t;
+
+static double
+replay_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+replay_print_string(FILE                     *out,
+                    const char               *name,
+                    const rdsparser_string_t *string)
+{
+    char buffer[RDSPARSER_ERT_LENGTH * 3 + 1];
+    rdsparser_string_get_utf8(string, buffer, sizeof(buffer));
+    fprintf(out, "%s: %s\n", name, buffer);
+}
+
+static void
+callback_pi(rdsparser_t *rds,
+            void        *user_data)
+{
+    fprintf(user_data, "PI: %04X\n", rdsparser_get_pi(rds));
+}
+
+static void
+callback_pty(rdsparser_t *rds,
+             void        *user_data)
+{
+    fprintf(user_data, "PTY: %d\n", rdsparser_get_pty(rds));
+}
+
+static void
+callback_tp(rdsparser_t *rds,
+            void        *user_data)
+{
+    fprintf(user_data, "TP: %d\n", rdsparser_get_tp(rds));
+}
+
+static void
+callback_ta(rdsparser_t *rds,
+            void        *user_data)
+{
+    fprintf(user_data, "TA: %d\n", rdsparser_get_ta(rds));
+}
+
+static void
+callback_ms(rdsparser_t *rds,
+            void        *user_data)
+{
+    fprintf(user_data, "MS: %d\n", rdsparser_get_ms(rds));
+}
+
+static void
+callback_ecc(rdsparser_t *rds,
+             void        *user_data)
+{
+    fprintf(user_data, "ECC: %02X\n", rdsparser_get_ecc(rds));
+}
+
+static void
+callback_af(rdsparser_t *rds,
+            uint32_t     new_af,
+            void        *user_data)
+{
+    fprintf(user_data, "AF: %u\n", new_af);
+}
+
+static void
+callback_ps(rdsparser_t *rds,
+            void        *user_data)
+{
+    replay_print_string(user_data, "PS", rdsparser_get_ps(rds));
+}
+
+static void
+callback_rt(rdsparser_t         *rds,
+            rdsparser_rt_flag_t  flag,
+            void                *user_data)
+{
+    replay_print_string(user_data, flag ? "RT1" : "RT0", rdsparser_get_rt(rds, flag));
+}
+
+static void
+callback_ptyn(rdsparser_t *rds,
+              void        *user_data)
+{
+    replay_print_string(user_data, "PTYN", rdsparser_get_ptyn(rds));
+}
+
+#ifndef RDSPARSER_DISABLE_GROUP4
+static void
+callback_ct(rdsparser_t          *rds,
+            const rdsparser_ct_t *ct,
+            void                 *user_data)
+{
+    fprintf(user_data, "CT: %lld\n", (long long)rdsparser_ct_get_epoch(ct));
+}
+#endif
+
+static void
+replay_register(rdsparser_t *rds,
+                FILE        *out)
+{
+    rdsparser_set_user_data(rds, out);
+    rdsparser_register_pi(rds, callback_pi);
+    rdsparser_register_pty(rds, callback_pty);
+    rdsparser_register_tp(rds, callback_tp);
+    rdsparser_register_ta(rds, callback_ta);
+    rdsparser_register_ms(rds, callback_ms);
+    rdsparser_register_ecc(rds, callback_ecc);
+    rdsparser_register_af(rds, callback_af);
+    rdsparser_register_ps(rds, callback_ps);
+    rdsparser_register_rt(rds, callback_rt);
+    rdsparser_register_ptyn(rds, callback_ptyn);
+#ifndef RDSPARSER_DISABLE_GROUP4
+    rdsparser_register_ct(rds, callback_ct);
+#endif
+}
+
+static bool
+replay_open(replay_input_t *input,
+            const char     *path)
+{
+    if (!rdsparser_file_map(path, &input->data, &input->length))
+    {
+        return false;
+    }
+
+    if (input->length == 0)
+    {
+        rdsparser_file_unmap(input->data, input->length);
+        return false;
+    }
+
+    input->binary = rdsparser_log_reader_init(&input->reader, (const uint8_t*)input->data, input->length);
+    input->line = input->data;
+    input->index = 0;
+    return true;
+}
+
+static void
+replay_close(replay_input_t *input)
+{
+    rdsparser_file_unmap(input->data, input->length);
+}
+
+static bool
+replay_next(replay_input_t    *input,
+            rdsparser_data_t   data,
+            rdsparser_error_t  errors,
+            uint64_t          *time)
+{
+    if (input->binary)
+    {
+        return rdsparser_log_read(&input->reader, data, errors, time);
+    }
+
+    if (!rdsparser_read_group(&input->line, input->data + input->length, data, errors))
+    {
+        return false;
+    }
+
+    /* Hex captures have no timestamps, assume the group rate */
+    *time = input->index++ * REPLAY_GROUP_NS / 1000000;
+    return true;
+}
+
+static int64_t
+replay_file_groups(rdsparser_t            *rds,
+                   const char             *path,
+                   const replay_options_t *options)
+{
+    replay_input_t input;
+    if (!replay_open(&input, path))
+    {
+        return -1;
+    }
+
+    rdsparser_data_t data;
+    rdsparser_error_t errors;
+    uint64_t time;
+    uint64_t last_time = 0;
+    int64_t count = 0;
+
+    while (replay_next(&input, data, errors, &time))
+    {
+        if (options->realtime &&
+            count &&
+            time > last_time)
+        {
+            const uint64_t delay_ms = time - last_time;
+            const struct timespec delay = { (time_t)(delay_ms / 1000), (long)(delay_ms % 1000) * 1000000L };
+            fflush(stdout);
+            nanosleep(&delay, NULL);
+        }
+
+        if (options->writer &&
+            !rdsparser_log_write(options->writer, time, data, errors))
+        {
+            replay_close(&input);
+            return -1;
+        }
+
+        rdsparser_parse_ts(rds, data, errors, time);
+        last_time = time;
+        count++;
+    }
+
+    replay_close(&input);
+    return count;
+}
+
+static int64_t
+replay_file(const char             *path,
+            const replay_options_t *options,
+            FILE                   *out,
+            double                 *elapsed)
+{
+#ifdef RDSPARSER_DISABLE_HEAP
+    rdsparser_t buffer;
+    rdsparser_init(&buffer);
+    rdsparser_t *rds = &buffer;
+#else
+    rdsparser_t *rds = rdsparser_new();
+    if (rds == NULL)
+    {
+        return -1;
+    }
+#endif
+
+    if (!options->quiet)
+    {
+        replay_register(rds, out);
+    }
+
+    const double start = replay_time();
+    const int64_t count = ((options->realtime || options->writer) ? replay_file_groups(rds, path, options)
+                                                                  : rdsparser_parse_file(rds, path));
+    *elapsed = replay_time() - start;
+
+#ifndef RDSPARSER_DISABLE_HEAP
+    rdsparser_free(rds);
+#endif
+
+    return count;
+}
+
+static int
+replay_report(const char *path,
+              int64_t     count,
+              double      elapsed)
+{
+    if (count < 0)
+    {
+        fprintf(stderr, "%s: unable to read the file\n", path);
+        return -1;
+    }
+
+    fprintf(stderr, "%s: %lld groups in %.3f s (%.0f groups/s)\n",
+            path,
+            (long long)count,
+            elapsed,
+            (elapsed > 0) ? count / elapsed : 0.0);
+    return 0;
+}
+
+static void*
+replay_worker(void *data)
+{
+    replay_worker_t *worker = data;
+    replay_pool_t *pool = worker->pool;
+    size_t index;
+
+    /* Each thread takes the next file, so long files do not hold up the others */
+    while ((index = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < pool->count)
+    {
+        replay_job_t *job = &pool->jobs[index];
+        FILE *out = NULL;
+
+        if (!pool->options->quiet &&
+            (out = open_memstream(&job->output, &job->output_size)) == NULL)
+        {
+            job->count = -1;
+        }
+        else
+        {
+            job->count = replay_file(job->path, pool->options, out, &job->elapsed);
+            if (out)
+            {
+                fclose(out);
+            }
+        }
+
+        worker->files++;
+        worker->busy += job->elapsed;
+
+        pthread_mutex_lock(&pool->mutex);
+        job->done = true;
+        pthread_cond_broadcast(&pool->cond);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+
+    return NULL;
+}
+
+static int
+replay_parallel(char * const             paths[],
+                size_t                   count,
+                unsigned int             threads,
+                const replay_options_t  *options)
+{
+    replay_job_t *jobs = calloc(count, sizeof(replay_job_t));
+    replay_worker_t *workers = calloc(threads, sizeof(replay_worker_t));
+    replay_pool_t pool = { .options = options, .jobs = jobs, .count = count };
+    int status = EXIT_SUCCESS;
+    unsigned int started = 0;
+
+    if (jobs == NULL ||
+        workers == NULL)
+    {
+        free(jobs);
+        free(workers);
+        return EXIT_FAILURE;
+    }
+
+    pthread_mutex_init(&pool.mutex, NULL);
+    pthread_cond_init(&pool.cond, NULL);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        jobs[i].path = paths[i];
+    }
+
+    const double start = replay_time();
+    for (; started < threads; started++)
+    {
+        workers[started].pool = &pool;
+        if (pthread_create(&workers[started].thread, NULL, replay_worker, &workers[started]) != 0)
+        {
+            break;
+        }
+    }
+
+    if (started == 0)
+    {
+        /* No threads at all, process everything here */
+        workers[0].pool = &pool;
+        replay_worker(&workers[0]);
+    }
+
+    /* Results are written in the order of the arguments */
+    int64_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        pthread_mutex_lock(&pool.mutex);
+        while (!jobs[i].done)
+        {
+            pthread_cond_wait(&pool.cond, &pool.mutex);
+        }
+        pthread_mutex_unlock(&pool.mutex);
+
+        if (jobs[i].output)
+        {
+            fwrite(jobs[i].output, 1, jobs[i].output_size, stdout);
+            free(jobs[i].output);
+        }
+
+        if (replay_report(jobs[i].path, jobs[i].count, jobs[i].elapsed) != 0)
+        {
+            status = EXIT_FAILURE;
+        }
+        else
+        {
+            total += jobs[i].count;
+        }
+    }
+
+    for (unsigned int i = 0; i < started; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    const double elapsed = replay_time() - start;
+    fprintf(stderr, "total: %lld groups in %.3f s (%.0f groups/s)\n",
+            (long long)total,
+            elapsed,
+            (elapsed > 0) ? total / elapsed : 0.0);
+
+    for (unsigned int i = 0; i < (started ? started : 1); i++)
+    {
+        fprintf(stderr, "thread %u: %zu files, %.1f%% busy\n",
+                i,
+                workers[i].files,
+                (elapsed > 0) ? 100.0 * workers[i].busy / elapsed : 0.0);
+    }
+
+    pthread_cond_destroy(&pool.cond);
+    pthread_mutex_destroy(&pool.mutex);
+    free(workers);
+    free(jobs);
+    return status;
+}
+
+static void
+replay_usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-q] [-r] [-w OUTPUT] [-j THREADS] FILE...\n", name);
+    fprintf(stderr, "  -q         do not print field changes\n");
+    fprintf(stderr, "  -r         replay at the recorded speed instead of as fast as possible\n");
+    fprintf(stderr, "  -w OUTPUT  write all groups to a binary log\n");
+    fprintf(stderr, "  -j THREADS process the files in parallel (with -q or buffered output)\n");
+}
+
+int
+main(int   argc,
+     char *argv[])
+{
+    replay_options_t options = { false, false, NULL };
+    rdsparser_log_writer_t writer;
+    const char *output = NULL;
+    unsigned int threads = 1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "qrw:j:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'q':
+                options.quiet = true;
+                break;
+
+            case 'r':
+                options.realtime = true;
+                break;
+
+            case 'w':
+                output = optarg;
+                break;
+
+            case 'j':
+                threads = (unsigned int)strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                replay_usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (optind >= argc ||
+        threads == 0)
+    {
+        replay_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (threads > 1)
+    {
+        if (options.realtime || output)
+        {
+            fprintf(stderr, "%s: -j cannot be combined with -r or -w\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        return replay_parallel(argv + optind, (size_t)(argc - optind), threads, &options);
+    }
+
+    FILE *file = NULL;
+    if (output)
+    {
+        file = fopen(output, "wb");
+        if (file == NULL ||
+            !rdsparser_log_writer_init(&writer, file, RDSPARSER_LOG_SYNC_INTERVAL))
+        {
+            fprintf(stderr, "%s: unable to write the file\n", output);
+            return EXIT_FAILURE;
+        }
+        options.writer = &writer;
+    }
+
+    int status = EXIT_SUCCESS;
+    for (int i = optind; i < argc; i++)
+    {
+        double elapsed;
+        const int64_t count = replay_file(argv[i], &options, stdout, &elapsed);
+        if (replay_report(argv[i], count, elapsed) != 0)
+        {
+            status = EXIT_FAILURE;
+        }
+    }
+
+    if (file &&
+        fclose(file) != 0)
+    {
+        status = EXIT_FAILURE;
+    }
+
+    return status;
+}